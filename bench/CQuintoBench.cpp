@@ -0,0 +1,274 @@
+#include <CQuintoEngine.h>
+#include <CQuintoSearch.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// best move search parallel scaling benchmark.
+//
+// Plays computer vs computer games and, for each position from the start
+// turn (dense boards), times the best move search for each thread count
+// (1, 2, 4, ... max threads) checking the best move matches the serial
+// search. Also checks a best move search with a small node budget (-budget)
+// never returns a lower score than its probe search found, and that the best
+// move placements don't depend on the hand slot order (moves are searched in
+// value order so equal score and tiles moves are tie broken by value).
+
+using namespace CQuinto;
+
+namespace {
+
+struct ThreadResult {
+  int    threads { 1 };
+  double time    { 0.0 };
+  long   nodes   { 0 };
+  long   tasks   { 0 };
+  long   steals  { 0 };
+};
+
+bool sameBestMove(const BestMove &lhs, const BestMove &rhs) {
+  if (lhs.score != rhs.score || lhs.moves.size() != rhs.moves.size())
+    return false;
+
+  for (size_t i = 0; i < lhs.moves.size(); ++i) {
+    const auto &from1 = lhs.moves[i].from(), &from2 = rhs.moves[i].from();
+    const auto &to1   = lhs.moves[i].to  (), &to2   = rhs.moves[i].to  ();
+
+    if (from1.owner != from2.owner || ! (from1.pos == from2.pos) ||
+        to1  .owner != to2  .owner || ! (to1  .pos == to2  .pos))
+      return false;
+  }
+
+  return true;
+}
+
+using HandValues = std::vector<int>;
+
+// same placements (board cell and tile value) for hand slot values
+bool samePlacements(const BestMove &lhs, const HandValues &lhand,
+                    const BestMove &rhs, const HandValues &rhand) {
+  if (lhs.score != rhs.score || lhs.moves.size() != rhs.moves.size())
+    return false;
+
+  for (size_t i = 0; i < lhs.moves.size(); ++i) {
+    const auto &lmove = lhs.moves[i], &rmove = rhs.moves[i];
+
+    if (! (lmove.to().pos == rmove.to().pos) ||
+        lhand[lmove.from().pos.ix] != rhand[rmove.from().pos.ix])
+      return false;
+  }
+
+  return true;
+}
+
+// check best move of current player is same with hand rotated by one slot
+bool rotatedBestMove(Game &game, const BestMove &bestMove) {
+  auto *player = game.currentPlayer().get();
+
+  int n = game.handSize();
+
+  HandValues hand(n), rotatedHand(n);
+
+  for (int i = 0; i < n; ++i)
+    hand[i] = player->tile(i);
+
+  for (int i = 0; i < n; ++i) {
+    rotatedHand[i] = hand[(i + 1) % n];
+
+    (void) player->takeTile(i, /*nocheck*/true);
+
+    player->addTile(rotatedHand[i], i);
+  }
+
+  Search search;
+
+  game.board()->initSearch(search);
+
+  search.setNumThreads(1);
+
+  BestMove rotatedMove;
+
+  search.calcBestMove(rotatedMove);
+
+  for (int i = 0; i < n; ++i) {
+    (void) player->takeTile(i, /*nocheck*/true);
+
+    player->addTile(hand[i], i);
+  }
+
+  return samePlacements(bestMove, hand, rotatedMove, rotatedHand);
+}
+
+void usage() {
+  std::cerr << "CQuintoBench [-seed <n>] [-games <n>] [-start <turn>] "
+               "[-threads <max>] [-split <depth>] [-budget <nodes>]\n";
+}
+
+}
+
+int
+main(int argc, char **argv)
+{
+  Seed seed       = 1;
+  int  numGames   = 2;
+  int  startTurn  = 8;
+  int  maxThreads = std::max(int(std::thread::hardware_concurrency()), 1);
+  int  splitDepth = 2;
+  long budgetNodes = 64;
+
+  for (int i = 1; i < argc; ++i) {
+    auto arg = argv[i];
+
+    if      (strcmp(arg, "-seed"   ) == 0 && i < argc - 1) seed       = strtoull(argv[++i], nullptr, 10);
+    else if (strcmp(arg, "-games"  ) == 0 && i < argc - 1) numGames   = atoi(argv[++i]);
+    else if (strcmp(arg, "-start"  ) == 0 && i < argc - 1) startTurn  = atoi(argv[++i]);
+    else if (strcmp(arg, "-threads") == 0 && i < argc - 1) maxThreads = atoi(argv[++i]);
+    else if (strcmp(arg, "-split"  ) == 0 && i < argc - 1) splitDepth = atoi(argv[++i]);
+    else if (strcmp(arg, "-budget" ) == 0 && i < argc - 1) budgetNodes = atol(argv[++i]);
+    else { usage(); return 1; }
+  }
+
+  // thread counts (powers of two and max)
+  std::vector<ThreadResult> results;
+
+  for (int n = 1; n < maxThreads; n *= 2) {
+    ThreadResult result;
+
+    result.threads = n;
+
+    results.push_back(result);
+  }
+
+  ThreadResult maxResult;
+
+  maxResult.threads = maxThreads;
+
+  results.push_back(maxResult);
+
+  //---
+
+  Game game;
+
+  game.init(seed);
+
+  game.player1()->setType(PlayerType::COMPUTER);
+  game.player2()->setType(PlayerType::COMPUTER);
+
+  auto *board = game.board().get();
+
+  board->setSearchSplitDepth(splitDepth);
+
+  int numPositions  = 0;
+  int numMismatches = 0;
+  int numBelowProbe = 0;
+  int numBelowFull  = 0;
+  int numHandOrder  = 0;
+
+  for (int ig = 0; ig < numGames; ++ig) {
+    if (ig > 0)
+      game.newGame(seed + ig);
+
+    int numTurns = 0;
+
+    while (! game.isGameOver() && numTurns < 400) {
+      ++numTurns;
+
+      if (! game.currentPlayer()->canMove()) {
+        game.nextTurn();
+
+        if (! game.currentPlayer()->canMove())
+          game.setGameOver(true);
+
+        continue;
+      }
+
+      // time search of position for each thread count
+      if (game.turn()->ind() >= startTurn) {
+        BestMove serialMove;
+
+        for (auto &result : results) {
+          board->setSearchThreads(result.threads);
+
+          board->invalidateBestMove();
+
+          const auto &bestMove = board->getBestMove();
+          const auto &stats    = board->searchStats();
+
+          result.time   += stats.time;
+          result.nodes  += stats.nodes;
+          result.tasks  += stats.tasks;
+          result.steals += stats.steals;
+
+          if      (result.threads == 1)
+            serialMove = bestMove;
+          else if (! sameBestMove(bestMove, serialMove))
+            ++numMismatches;
+        }
+
+        // hand slot order doesn't change best move
+        if (! rotatedBestMove(game, serialMove))
+          ++numHandOrder;
+
+        // node budgeted search is at least as good as its probe
+        if (budgetNodes > 0) {
+          Search search;
+
+          board->initSearch(search);
+
+          search.setBudget(0.0, budgetNodes);
+
+          BestMove budgetMove;
+
+          search.calcBestMove(budgetMove);
+
+          if (budgetMove.score < search.probeScore())
+            ++numBelowProbe;
+
+          if (budgetMove.score < serialMove.score)
+            ++numBelowFull;
+        }
+
+        ++numPositions;
+      }
+
+      board->playBestMove();
+
+      game.apply();
+    }
+  }
+
+  //---
+
+  std::cout << "positions=" << numPositions << " split=" << splitDepth <<
+               " mismatches=" << numMismatches <<
+               " hand_order_mismatches=" << numHandOrder << "\n";
+
+  if (budgetNodes > 0)
+    std::cout << "budget=" << budgetNodes << " below_probe=" << numBelowProbe <<
+                 " below_full=" << numBelowFull << "\n";
+
+  std::cout << std::setw(8) << "threads" << std::setw(12) << "time(ms)" <<
+               std::setw(10) << "speedup" << std::setw(8) << "eff" <<
+               std::setw(12) << "nodes" << std::setw(10) << "tasks" <<
+               std::setw(10) << "steals" << "\n";
+
+  double serialTime = results[0].time;
+
+  for (const auto &result : results) {
+    double speedup = (result.time > 0.0 ? serialTime/result.time : 0.0);
+
+    std::cout << std::setw(8) << result.threads <<
+                 std::setw(12) << std::fixed << std::setprecision(1) << result.time*1000.0 <<
+                 std::setw(10) << std::setprecision(2) << speedup <<
+                 std::setw(8) << speedup/result.threads <<
+                 std::setw(12) << result.nodes << std::setw(10) << result.tasks <<
+                 std::setw(10) << result.steals << "\n";
+  }
+
+  return (numMismatches == 0 && numHandOrder == 0 && numBelowProbe == 0 ? 0 : 1);
+}
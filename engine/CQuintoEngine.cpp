@@ -0,0 +1,1649 @@
+#include <CQuintoEngine.h>
+#include <CQuintoSearch.h>
+#include <CQuintoPosition.h>
+
+#ifdef USE_HR_TIMER
+#include <CHRTimer.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+namespace CQuinto {
+
+//------
+
+Game::
+Game()
+{
+}
+
+Game::
+~Game()
+{
+  for (auto &turn : turns_)
+    delete turn;
+
+  delete turn_;
+}
+
+void
+Game::
+init(Seed seed)
+{
+  tileSet_ = std::make_unique<TileSet>(seed);
+
+  player1_ = std::make_unique<Player>(this, TileOwner::PLAYER1, "Player"  , PlayerType::HUMAN   );
+  player2_ = std::make_unique<Player>(this, TileOwner::PLAYER2, "Computer", PlayerType::COMPUTER);
+
+  currentPlayerOwner_ = TileOwner::PLAYER1;
+
+  board_ = std::make_unique<Board>(this);
+
+  turn_ = new Turn(this, 0);
+
+  //---
+
+  player1_->drawTiles();
+  player2_->drawTiles();
+}
+
+void
+Game::
+cancel()
+{
+  int n = turn_->moves().size();
+
+  for (int i = n - 1; i >= 0; --i) {
+    auto move = turn_->move(i);
+
+    undoMove(move);
+  }
+
+  turn_->clear();
+}
+
+void
+Game::
+back()
+{
+  int n = turn_->moves().size();
+
+  if (n > 0) {
+    auto move = turn_->move(n - 1);
+
+    undoMove(move);
+
+    turn_->popMove();
+  }
+}
+
+bool
+Game::
+apply()
+{
+  // check valid
+  auto validScore = isTurnValid();
+
+  if (! validScore.valid)
+    return false;
+
+  assert((validScore.score % 5) == 0);
+
+  // update score
+  currentPlayer()->addScore(validScore.score);
+
+  // get new tiles
+  currentPlayer()->drawTiles();
+
+  //---
+
+  nextTurn();
+
+  return true;
+}
+
+void
+Game::
+newGame(Seed seed)
+{
+  const int handSize = this->handSize();
+
+  // move all board and player tiles back to tile set
+  for (int i = 0; i < handSize; ++i) {
+    auto value1 = player1_->takeTile(i, /*nocheck*/true);
+    auto value2 = player2_->takeTile(i, /*nocheck*/true);
+
+    if (value1 >= 0) tileSet_->ungetTile(value1);
+    if (value2 >= 0) tileSet_->ungetTile(value2);
+  }
+
+  const int nx = this->nx();
+  const int ny = this->ny();
+
+  for (int iy = 0; iy < ny; ++iy) {
+    for (int ix = 0; ix < nx; ++ix) {
+      TilePosition pos(ix, iy);
+
+      if (board_->hasCell(pos)) {
+        auto cell = board_->takeCell(pos);
+
+        tileSet_->ungetTile(cell.value);
+      }
+    }
+  }
+
+  //---
+
+  // reset current player and player scores
+  currentPlayerOwner_ = TileOwner::PLAYER1;
+
+  player1_->setScore(0);
+  player2_->setScore(0);
+
+  player1_->setCanMove(true);
+  player2_->setCanMove(true);
+
+  //---
+
+  // reset turns
+  for (auto &turn : turns_)
+    delete turn;
+
+  turns_.clear();
+
+  delete turn_;
+
+  turn_ = new Turn(this, 0);
+
+  //---
+
+  // shuffle tiles
+  tileSet_->shuffle(seed);
+
+  //---
+
+  // redraw player tiles
+  player1_->drawTiles();
+  player2_->drawTiles();
+
+  //---
+
+  board_->startTurn();
+
+  gameOver_ = false;
+}
+
+void
+Game::
+getPosition(Position &position) const
+{
+  position.reset();
+
+  const int handSize = std::min(this->handSize(), int(Position::HAND_SIZE));
+
+  for (int i = 0; i < handSize; ++i) {
+    position.hands[0][i] = int8_t(player1_->tile(i));
+    position.hands[1][i] = int8_t(player2_->tile(i));
+  }
+
+  // earlier turn cells and current turn cells (values)
+  struct TurnCell {
+    TilePosition pos;
+    int          value { -1 };
+  };
+
+  TurnCell turnCells[Board::MAX_TURN_CELLS];
+  int      numTurnCells = 0;
+
+  auto turnInd = turn_->ind();
+
+  for (int iy = 0; iy < Position::NY; ++iy) {
+    for (int ix = 0; ix < Position::NX; ++ix) {
+      auto cell = board_->cell(TilePosition(ix, iy));
+
+      if (! cell.isSet())
+        continue;
+
+      if (cell.turn == turnInd) {
+        assert(numTurnCells < Board::MAX_TURN_CELLS);
+
+        turnCells[numTurnCells].pos   = TilePosition(ix, iy);
+        turnCells[numTurnCells].value = cell.value;
+
+        ++numTurnCells;
+      }
+      else {
+        position.values[iy][ix] = int8_t(cell.value);
+        position.owners[iy][ix] = cell.player;
+      }
+    }
+  }
+
+  // undo current turn moves on copy to return turn tiles to hand slots
+  auto findTurnCell = [&](const TilePosition &pos) {
+    for (int i = 0; i < numTurnCells; ++i)
+      if (turnCells[i].pos == pos)
+        return i;
+
+    return -1;
+  };
+
+  int hand = (currentPlayerOwner_ == TileOwner::PLAYER1 ? 0 : 1);
+
+  const auto &moves = turn_->moves();
+
+  for (int i = int(moves.size()) - 1; i >= 0; --i) {
+    const auto &from = moves[i].from();
+    const auto &to   = moves[i].to  ();
+
+    if      (from.owner != TileOwner::BOARD) {
+      // hand to board : back to hand
+      int ind = findTurnCell(to.pos);
+      if (ind < 0) continue;
+
+      position.hands[hand][from.pos.ix] = int8_t(turnCells[ind].value);
+
+      turnCells[ind] = turnCells[--numTurnCells];
+    }
+    else if (to.owner != TileOwner::BOARD) {
+      // board to hand : back to board
+      assert(numTurnCells < Board::MAX_TURN_CELLS);
+
+      turnCells[numTurnCells].pos   = from.pos;
+      turnCells[numTurnCells].value = position.hands[hand][to.pos.ix];
+
+      ++numTurnCells;
+
+      position.hands[hand][to.pos.ix] = -1;
+    }
+    else {
+      // board to board : back to previous cell
+      int ind = findTurnCell(to.pos);
+      if (ind < 0) continue;
+
+      turnCells[ind].pos = from.pos;
+    }
+  }
+
+  // turn tiles placed without recorded moves (e.g. Board::playBestMove) go
+  // back to first empty hand slots
+  for (int i = 0, j = 0; i < numTurnCells; ++i) {
+    while (j < handSize && position.hands[hand][j] >= 0)
+      ++j;
+
+    if (j < handSize)
+      position.hands[hand][j] = int8_t(turnCells[i].value);
+  }
+
+  //---
+
+  position.scores[0] = player1_->score();
+  position.scores[1] = player2_->score();
+
+  position.player = currentPlayerOwner_;
+  position.turn   = turnInd;
+
+  position.numTiles = std::min(tileSet_->numTiles(), int(Position::MAX_TILES));
+
+  for (int i = 0; i < position.numTiles; ++i)
+    position.tiles[i] = int8_t(tileSet_->tile(i));
+}
+
+void
+Game::
+setPosition(const Position &position)
+{
+  // reset turns (cells are placed as tiles of earlier turn)
+  for (auto &turn : turns_)
+    delete turn;
+
+  turns_.clear();
+
+  delete turn_;
+
+  turn_ = new Turn(this, position.turn);
+
+  //---
+
+  // replace board cells
+  const int nx = this->nx();
+  const int ny = this->ny();
+
+  for (int iy = 0; iy < ny; ++iy) {
+    for (int ix = 0; ix < nx; ++ix) {
+      TilePosition pos(ix, iy);
+
+      if (board_->hasCell(pos))
+        (void) board_->takeCell(pos);
+
+      auto value = position.values[iy][ix];
+
+      if (value >= 0)
+        board_->setCell(pos, Cell(value, position.owners[iy][ix], position.turn - 1));
+    }
+  }
+
+  //---
+
+  // replace hands and scores
+  const int handSize = std::min(this->handSize(), int(Position::HAND_SIZE));
+
+  for (int i = 0; i < handSize; ++i) {
+    (void) player1_->takeTile(i, /*nocheck*/true);
+    (void) player2_->takeTile(i, /*nocheck*/true);
+
+    if (position.hands[0][i] >= 0) player1_->addTile(position.hands[0][i], i);
+    if (position.hands[1][i] >= 0) player2_->addTile(position.hands[1][i], i);
+  }
+
+  player1_->setScore(position.scores[0]);
+  player2_->setScore(position.scores[1]);
+
+  //---
+
+  // replace undrawn tiles
+  tileSet_->clear();
+
+  for (int i = 0; i < position.numTiles; ++i)
+    tileSet_->ungetTile(position.tiles[i]);
+
+  //---
+
+  currentPlayerOwner_ = position.player;
+
+  board_->startTurn();
+
+  gameOver_ = false;
+
+  player1_->setCanMove(true);
+  player2_->setCanMove(true);
+
+  currentPlayer()->setCanMove(canMove());
+}
+
+void
+Game::
+nextTurn()
+{
+  // next turn
+  turns_.push_back(turn_);
+
+  auto ind = turn_->ind() + 1;
+
+  turn_ = new Turn(this, ind);
+
+  //---
+
+  // switch to next player
+  currentPlayerOwner_ =
+    (currentPlayerOwner_ == TileOwner::PLAYER1 ? TileOwner::PLAYER2 : TileOwner::PLAYER1);
+
+  //---
+
+  board_->startTurn();
+
+  //---
+
+  currentPlayer()->setCanMove(canMove());
+}
+
+bool
+Game::
+canMove() const
+{
+#ifdef USE_HR_TIMER
+  //CScopeTimer timer("Game::canMove");
+#endif
+
+  if (currentPlayer()->numTiles() == 0)
+    return false;
+
+  const auto &details = board_->boardDetails();
+
+  if (! details.valid)
+    return false;
+
+  if (details.validPositions.empty())
+    return false;
+
+  // only check a move exists (uses best move if already calculated), computer
+  // best move is searched when played (may be in background thread)
+  return board_->hasMove();
+}
+
+ValidScore
+Game::
+isTurnValid() const
+{
+  const auto &details = board_->boardDetails();
+
+  ValidScore validScore;
+
+  validScore.valid = details.valid && ! details.partial;
+  validScore.score = details.score;
+
+  return validScore;
+}
+
+void
+Game::
+undoMove(const Move &move)
+{
+  doMoveParts(move.to(), move.from());
+}
+
+void
+Game::
+doMove(const Move &move)
+{
+  doMoveParts(move.from(), move.to());
+}
+
+void
+Game::
+doMoveParts(const TileData &from, const TileData &to)
+{
+  if      (from.owner == TileOwner::PLAYER1 ||
+           from.owner == TileOwner::PLAYER2) {
+    assert(to.owner == TileOwner::BOARD);
+
+    auto value = ownerPlayer(from.owner)->takeTile(from.pos.ix);
+    assert(value >= 0);
+
+    board_->setCell(to.pos, Cell(value, from.owner, turn()->ind()));
+  }
+  else if (from.owner == TileOwner::BOARD) {
+    if      (to.owner == TileOwner::PLAYER1 ||
+             to.owner == TileOwner::PLAYER2) {
+      auto fromCell = board_->takeCell(from.pos);
+      assert(fromCell.isSet());
+
+      ownerPlayer(to.owner)->addTile(fromCell.value, to.pos.ix);
+    }
+    else if (to.owner == TileOwner::BOARD) {
+      auto fromCell = board_->takeCell(from.pos);
+      assert(fromCell.isSet());
+
+      board_->setCell(to.pos, fromCell);
+    }
+  }
+  else {
+    assert(false);
+  }
+}
+
+int
+Game::
+moveScore(const Move &move) const
+{
+  auto to = move.to();
+
+  if (to.owner == TileOwner::BOARD) {
+    const auto &cell = board_->cell(to.pos);
+
+    if (cell.isSet())
+      return cell.value;
+  }
+
+  return 0;
+}
+
+void
+Game::
+addMove(const Move &move)
+{
+  turn_->addMove(move);
+}
+
+//---
+
+const char *
+errorText(ErrorCode error)
+{
+  switch (error) {
+    case ErrorCode::LINE_TOO_LONG     : return "Line too long";
+    case ErrorCode::NOT_MULTIPLE_5    : return "Not a multiple of 5";
+    case ErrorCode::NOT_MULTIPLE_5_YET: return "Not a multiple of 5 (yet)";
+    case ErrorCode::DISJOINT_PIECES   : return "Disjoint pieces";
+    default                           : return "";
+  }
+}
+
+//---
+
+TileData::
+TileData(TileOwner owner, const TilePosition &pos) :
+ owner(owner), pos(pos)
+{
+}
+
+void
+TileData::
+print(std::ostream &os) const
+{
+  if      (owner == TileOwner::PLAYER1 ) { os << "Player1:" << pos.ix; }
+  else if (owner == TileOwner::PLAYER2 ) { os << "Player2:" << pos.ix; }
+  else if (owner == TileOwner::BOARD   ) { os << "Board:" << pos.ix << "," << pos.iy; }
+  else if (owner == TileOwner::TILE_SET) { os << "TileSet:"; }
+}
+
+//---
+
+uint64_t
+Random::
+next()
+{
+  // splitmix64
+  uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+
+  z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+
+  return z ^ (z >> 31);
+}
+
+int
+Random::
+range(int n)
+{
+  assert(n > 0);
+
+  // reject values above last whole multiple of n (no modulo bias)
+  uint64_t un    = uint64_t(n);
+  uint64_t limit = UINT64_MAX - UINT64_MAX % un;
+
+  uint64_t r = next();
+
+  while (r >= limit)
+    r = next();
+
+  return int(r % un);
+}
+
+Seed
+Random::
+randomSeed()
+{
+  std::random_device device;
+
+  auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+
+  return (Seed(device()) << 32) ^ Seed(device()) ^ Seed(now);
+}
+
+//---
+
+template<typename FN, typename... ARGS>
+auto curry(FN fn, ARGS... args) {
+  return [=](auto... rest) { return fn(args..., rest...); };
+}
+
+template<typename FN>
+auto repeatFn(int n, FN fn) {
+  for (int i = 0; i < n; ++i)
+    fn();
+}
+
+TileSet::
+TileSet(Seed seed)
+{
+  auto addTile = [&](int value) {
+    tiles_.push_back(value);
+  };
+
+  /* 7  - #0 Tiles */ repeatFn( 7, curry(addTile, 0));
+  /* 6  - #1 Tiles */ repeatFn( 6, curry(addTile, 1));
+  /* 6  - #2 Tiles */ repeatFn( 6, curry(addTile, 2));
+  /* 7  - #3 Tiles */ repeatFn( 7, curry(addTile, 3));
+  /* 10 - #4 Tiles */ repeatFn(10, curry(addTile, 4));
+  /* 6  - #5 Tiles */ repeatFn( 6, curry(addTile, 5));
+  /* 10 - #6 Tiles */ repeatFn(10, curry(addTile, 6));
+  /* 14 - #7 Tiles */ repeatFn(14, curry(addTile, 7));
+  /* 12 - #8 Tiles */ repeatFn(12, curry(addTile, 8));
+  /* 12 - #9 Tiles */ repeatFn(12, curry(addTile, 9));
+
+  shuffle(seed);
+}
+
+void
+TileSet::
+shuffle(Seed seed)
+{
+  seed_ = seed;
+
+  random_.setSeed(seed);
+
+  std::sort(tiles_.begin(), tiles_.end());
+
+  // Fisher-Yates
+  for (int i = int(tiles_.size()) - 1; i > 0; --i)
+    std::swap(tiles_[i], tiles_[random_.range(i + 1)]);
+}
+
+int
+TileSet::
+getTile()
+{
+  if (tiles_.empty())
+    return -1;
+
+  auto value = tiles_.back();
+
+  tiles_.pop_back();
+
+  return value;
+}
+
+void
+TileSet::
+ungetTile(int value)
+{
+  tiles_.push_back(value);
+}
+
+//---
+
+Player::
+Player(Game *game, TileOwner owner, const std::string &name, PlayerType type) :
+ game_(game), owner_(owner), name_(name), type_(type)
+{
+  const int handSize = game_->handSize();
+
+  for (int i = 0; i < handSize; ++i)
+    tiles_.push_back(-1);
+}
+
+int
+Player::
+numTiles() const
+{
+  const int handSize = game_->handSize();
+
+  auto n = 0;
+
+  for (int i = 0; i < handSize; ++i)
+    if (hasTile(i))
+      ++n;
+
+  return n;
+}
+
+void
+Player::
+drawTiles()
+{
+  int nt = tiles_.size();
+
+  for (int i = 0; i < nt; ++i) {
+    if (hasTile(i))
+      continue;
+
+    auto value = game_->tileSet()->getTile();
+
+    if (value < 0)
+      break;
+
+    tiles_[i] = value;
+  }
+}
+
+int
+Player::
+tile(int i) const
+{
+  //assert(i >= 0 && i < game_->handSize());
+
+  return tiles_[i];
+}
+
+int
+Player::
+takeTile(int i, bool nocheck)
+{
+  //assert(i >= 0 && i < game_->handSize());
+
+  auto value = tiles_[i];
+
+  if (nocheck) {
+    if (value < 0)
+      return -1;
+  }
+  else {
+    assert(value >= 0);
+  }
+
+  tiles_[i] = -1;
+
+  return value;
+}
+
+void
+Player::
+addTile(int value, int i)
+{
+  //assert(i >= 0 && i < game_->handSize());
+
+  //assert(! hasTile(i));
+
+  tiles_[i] = value;
+}
+
+//---
+
+Board::
+Board(Game *game) :
+ game_(game)
+{
+  assert(game_->nx() == BitBoard::NX && game_->ny() == BitBoard::NY);
+
+  search_ = std::make_unique<Search>();
+}
+
+Board::
+~Board()
+{
+}
+
+bool
+Board::
+validPos(const TilePosition &pos) const
+{
+  return (pos.ix >= 0 && pos.ix < game_->nx() && pos.iy >= 0 && pos.iy < game_->ny());
+}
+
+Cell
+Board::
+takeCell(const TilePosition &pos)
+{
+  //assert(validPos(pos));
+
+  auto cell = this->cell(pos);
+  assert(cell.isSet());
+
+  bits_.reset(pos.ix, pos.iy);
+
+  for (int i = 0; i < numTurnCells_; ++i) {
+    if (turnCells_[i] == pos) {
+      turnCells_[i] = turnCells_[--numTurnCells_];
+      break;
+    }
+  }
+
+  invalidateDetails();
+  invalidateBestMove();
+
+  return cell;
+}
+
+void
+Board::
+setCell(const TilePosition &pos, const Cell &cell)
+{
+  //assert(validPos(pos));
+
+  bits_.set(pos.ix, pos.iy, cell.value, cell.turn, int(cell.player));
+
+  if (cell.turn == game_->turn()->ind()) {
+    assert(numTurnCells_ < MAX_TURN_CELLS);
+
+    turnCells_[numTurnCells_++] = pos;
+  }
+
+  invalidateDetails();
+  invalidateBestMove();
+}
+
+void
+Board::
+startTurn()
+{
+  numTurnCells_ = 0;
+
+  invalidateDetails();
+  invalidateBestMove();
+}
+
+bool
+Board::
+playBestMove()
+{
+  const BestMove &bestMove = getBestMove();
+
+  if (! bestMove.isValid())
+    return false; // assert ?
+
+  for (const auto &move : bestMove.moves)
+    game_->doMove(move);
+
+  return true;
+}
+
+void
+Board::
+showBestMove() const
+{
+  const BestMove &bestMove = getBestMove();
+
+  if (! bestMove.isValid())
+    return; // assert ?
+
+  std::cerr << "Best Moves:";
+
+  for (const auto &move : bestMove.moves) {
+    std::cerr << " ";
+
+    move.print(std::cerr);
+  }
+
+  std::cerr << " @" << bestMove.score;
+
+  if (! bestMove.proven)
+    std::cerr << " (not proven)";
+
+  std::cerr << "\n";
+}
+
+const BestMove &
+Board::
+getBestMove() const
+{
+  if (! bestMoveValid_) {
+    auto th = const_cast<Board *>(this);
+
+    th->calcBestMove();
+
+    th->bestMoveValid_ = true;
+  }
+
+  return bestMove_;
+}
+
+void
+Board::
+calcBestMove()
+{
+  // search copy of board and current player hand
+  initSearch(*search_);
+
+  search_->calcBestMove(bestMove_);
+
+  updateSearchStats("Search", search_->stats());
+}
+
+void
+Board::
+setBestMove(const BestMove &bestMove, const SearchStats &stats)
+{
+  bestMove_      = bestMove;
+  bestMoveValid_ = true;
+
+  updateSearchStats("Search", stats);
+}
+
+bool
+Board::
+hasMove() const
+{
+  if (bestMoveValid_)
+    return bestMove_.isValid();
+
+  initSearch(*search_);
+
+  bool found = search_->hasMove();
+
+  // kept separate so last (computer) search stats are not replaced
+  hasMoveStats_ = search_->stats();
+
+  printSearchStats("Has Move", hasMoveStats_);
+
+  return found;
+}
+
+void
+Board::
+initSearch(Search &search) const
+{
+  initSearch(search, *game_->currentPlayer(), game_->turn()->ind());
+}
+
+void
+Board::
+initSearch(Search &search, const Player &player, int turn) const
+{
+  search.init(*this, player, turn);
+
+  search.setTree      (searchTree_      );
+  search.setBounded   (searchBounded_   );
+  search.setNumThreads(searchThreads_   );
+  search.setSplitDepth(searchSplitDepth_);
+  search.setBudget    (searchTimeLimit_, searchNodeLimit_);
+}
+
+void
+Board::
+updateSearchStats(const char *name, const SearchStats &stats)
+{
+  searchStats_ = stats;
+
+  printSearchStats(name, searchStats_);
+}
+
+void
+Board::
+printSearchStats(const char *name, const SearchStats &stats) const
+{
+  if (printStats_) {
+    std::cerr << name << ": ";
+
+    stats.print(std::cerr);
+
+    std::cerr << "\n";
+  }
+}
+
+MoveTree *
+Board::
+boardMoveTree() const
+{
+  initSearch(*search_);
+
+  return search_->moveTree();
+}
+
+const BoardDetails &
+Board::
+boardDetails() const
+{
+  if (! detailsValid_) {
+    auto th = const_cast<Board *>(this);
+
+    th->calcBoardDetails();
+
+    th->detailsValid_ = true;
+  }
+
+  return details_;
+}
+
+// depends on cells, current turn
+void
+Board::
+calcBoardDetails()
+{
+  calcDetails(bits_, turnCells_, numTurnCells_, details_);
+}
+
+void
+Board::
+getBoardLines(BoardLines &boardLines) const
+{
+  getLines(bits_, turnCells_, numTurnCells_, boardLines);
+}
+
+void
+Board::
+calcDetails(const BitBoard &bits, const TilePosition *turnCells, int numTurnCells,
+            BoardDetails &details)
+{
+  auto addValidPosition = [&](const TilePosition &pos) {
+    //assert(! hasCell(pos));
+
+    details.addValidPosition(pos);
+  };
+
+  //---
+
+  details.reset();
+
+  details.valid   = true;
+  details.partial = false;
+
+  //---
+
+  const int nx = BitBoard::NX;
+  const int ny = BitBoard::NY;
+
+  //---
+
+  // count number of tiles and current move tiles and save row/columns
+  // containing current move tiles
+  BoardLines boardLines;
+
+  details.nt  = bits.count();
+  details.npt = numTurnCells;
+
+  for (int i = 0; i < numTurnCells; ++i) {
+    boardLines.xinds |= BitBoard::RowBits(1) << turnCells[i].ix;
+    boardLines.yinds |= BitBoard::ColBits(1 << turnCells[i].iy);
+  }
+
+  //---
+
+  // if board empty then must be valid
+  // return center positions for valid positions
+  if (details.nt == 0) {
+#if 0
+    // multiple center positions
+    auto ix1 = (nx - 1)/2, ix2 = nx/2;
+    auto iy1 = (ny - 1)/2, iy2 = ny/2;
+
+    addValidPosition(TilePosition(ix1, iy1));
+    addValidPosition(TilePosition(ix2, iy1));
+    addValidPosition(TilePosition(ix1, iy2));
+    addValidPosition(TilePosition(ix2, iy2));
+#else
+    // single center position
+    auto ix1 = (nx - 1)/2;
+    auto iy1 = (ny - 1)/2;
+
+    addValidPosition(TilePosition(ix1, iy1));
+#endif
+
+    details.partial = true;
+
+    return;
+  }
+
+  //----
+
+  // no tiles placed yet (for current player) then must be valid,
+  if (details.npt == 0) {
+    //assert(! boardLines.xinds && ! boardLines.yinds);
+
+    // play off existing pieces (board not empty) : bit board anchor cells
+    // (empty cells with surrounding tiles and run lengths that allow a tile)
+    for (int iy = 0; iy < ny; ++iy) {
+      auto anchors = bits.anchorRow(iy);
+
+      while (anchors) {
+        auto ix = __builtin_ctz(anchors);
+
+        anchors &= anchors - 1;
+
+        addValidPosition(TilePosition(ix, iy));
+      }
+    }
+
+    // can't apply yet
+    details.partial = true;
+
+    return;
+  }
+
+  //---
+
+  // get connected lines, length 2 or more, including at least one turn piece
+  getLines(bits, turnCells, numTurnCells, boardLines);
+
+  //---
+
+  // check all lines
+  for (const auto &line : boardLines.hlines) {
+    LineValid lineValid;
+
+    details.valid = line.isValid(lineValid);
+
+    details.partial = lineValid.partial;
+    details.error   = lineValid.error;
+
+    if (! details.valid) {
+      //line.print(std::cerr, details.error); std::cerr << "\n";
+      return;
+    }
+  }
+
+  for (const auto &line : boardLines.vlines) {
+    LineValid lineValid;
+
+    details.valid = line.isValid(lineValid);
+
+    details.partial = lineValid.partial;
+    details.error   = lineValid.error;
+
+    //line.print(std::cerr, details.error); std::cerr << "\n";
+
+    if (! details.valid)
+      return;
+  }
+
+  //---
+
+  // single piece played then check row or column
+  if (details.npt == 1) {
+    //assert(boardLines.numX() == 1 && boardLines.numY() == 1);
+
+    auto ix1 = __builtin_ctz(boardLines.xinds);
+    auto iy1 = __builtin_ctz(boardLines.yinds);
+
+    //---
+
+    // play off vertical lines of existing piece (board not empty) : empty
+    // cells in column with tile above or below
+    auto colEnds = bits.runEndsCol(ix1);
+
+    while (colEnds) {
+      auto iy = __builtin_ctz(colEnds);
+
+      colEnds &= colEnds - 1;
+
+      // vertical line through cell (cached run counts at top and bottom)
+      if (bits.vcross(ix1, iy).len > 5)
+        continue;
+
+      //---
+
+      addValidPosition(TilePosition(ix1, iy));
+    }
+
+    //---
+
+    // play off horizontal lines of existing piece (board not empty) : empty
+    // cells in row with tile to left or right
+    auto rowEnds = bits.runEndsRow(iy1);
+
+    while (rowEnds) {
+      auto ix = __builtin_ctz(rowEnds);
+
+      rowEnds &= rowEnds - 1;
+
+      // horizontal line through cell (cached run counts to left and right)
+      if (bits.hcross(ix, iy1).len > 5)
+        continue;
+
+      //---
+
+      addValidPosition(TilePosition(ix, iy1));
+    }
+
+    //---
+
+    details.valid   = true;
+    details.score   = boardLines.score();
+    details.partial = ((details.score % 5) != 0);
+
+    return;
+  }
+
+  //---
+
+  // two or more pieces. must be in a single row or column
+  if (boardLines.numX() > 1 && boardLines.numY() > 1) {
+    details.valid = false;
+    details.error = ErrorCode::DISJOINT_PIECES;
+    return;
+  }
+
+  //---
+
+  bool horizontal = (boardLines.numX() > 1);
+
+  //---
+
+  TileLines &lines = (horizontal ? boardLines.hlines : boardLines.vlines);
+  //assert(! lines.empty());
+
+  //---
+
+  // score all lines
+  details.score = boardLines.score();
+
+  //---
+
+  details.partial = ((details.score % 5) != 0);
+
+  //---
+
+  // add valid positions (end of lines)
+  for (const auto &line : lines) {
+    if (line.len() >= 5)
+      continue;
+
+    if (horizontal) {
+      auto ix1 = line.start - 1;
+      auto ix2 = line.end   + 1;
+
+      if (ix1 >= 0 ) addValidPosition(TilePosition(ix1, line.pos));
+      if (ix2 <  nx) addValidPosition(TilePosition(ix2, line.pos));
+    }
+    else {
+      auto iy1 = line.start - 1;
+      auto iy2 = line.end   + 1;
+
+      if (iy1 >= 0 ) addValidPosition(TilePosition(line.pos, iy1));
+      if (iy2 <  ny) addValidPosition(TilePosition(line.pos, iy2));
+    }
+  }
+
+  //---
+
+  if (! details.partial) {
+    //assert((details.score % 5) == 0);
+  }
+}
+
+void
+Board::
+getLines(const BitBoard &bits, const TilePosition *turnCells, int numTurnCells,
+         BoardLines &boardLines)
+{
+#ifdef USE_HR_TIMER
+  //auto *timer = CIncrementalTimerMgrInst->get("Board::getLines");
+  //CIncrementalTimerScope stimer(timer);
+#endif
+
+  //---
+
+  TileLine shline, svline;
+
+  // add line if not already added
+  auto addLine = [&](TileLines &lines, const TileLine &line) {
+    for (const auto &line1 : lines) {
+      if (line1.pos == line.pos && line1.start == line.start)
+        return;
+    }
+
+    lines.push_back(line);
+  };
+
+  // get horizontal and vertical runs through each current tile from run tables
+  for (int i = 0; i < numTurnCells; ++i) {
+    const auto &pos = turnCells[i];
+
+    const auto &hrun = bits.hrun(pos.ix, pos.iy);
+    const auto &vrun = bits.vrun(pos.ix, pos.iy);
+
+    TileLine hline(Direction::HORIZONTAL, hrun.start, hrun.end, pos.iy);
+    TileLine vline(Direction::VERTICAL  , vrun.start, vrun.end, pos.ix);
+
+    hline.sum = hrun.sum;
+    vline.sum = vrun.sum;
+
+    // ignore unit line
+    if (hline.len() == 1)
+      shline = hline;
+    else
+      addLine(boardLines.hlines, hline);
+
+    if (vline.len() == 1)
+      svline = vline;
+    else
+      addLine(boardLines.vlines, vline);
+  }
+
+  //---
+
+  // count current tiles in each line and sort into row/column order
+  auto updateLines = [&](TileLines &lines) {
+    for (auto &line : lines) {
+      for (int i = 0; i < numTurnCells; ++i)
+        if (line.hasPosition(turnCells[i]))
+          ++line.current;
+    }
+
+    std::sort(lines.begin(), lines.end(), [](const TileLine &lhs, const TileLine &rhs) {
+      return (lhs.pos < rhs.pos || (lhs.pos == rhs.pos && lhs.start < rhs.start));
+    });
+  };
+
+  updateLines(boardLines.hlines);
+  updateLines(boardLines.vlines);
+
+  if (boardLines.hlines.empty() && boardLines.vlines.empty()) {
+    auto value = bits.value(shline.start, shline.pos);
+
+    shline.sum = value;
+    svline.sum = value;
+
+    boardLines.hlines.push_back(shline);
+    boardLines.vlines.push_back(svline);
+  }
+}
+
+//------
+
+int
+BoardLines::
+score() const
+{
+  // score all lines
+  int score = 0;
+
+  for (const auto &line : hlines)
+    score += line.sum;
+
+  for (const auto &line : vlines)
+    score += line.sum;
+
+  return score;
+}
+
+//------
+
+TileLine::
+TileLine(Direction direction, int start, int end, int pos) :
+ direction(direction), start(start), end(end), pos(pos)
+{
+}
+
+int
+TileLine::
+len() const
+{
+  //assert(start >= 0 && end >= start);
+
+  return end - start + 1;
+}
+
+bool
+TileLine::
+hasPosition(const TilePosition &p) const
+{
+  if (direction == Direction::HORIZONTAL)
+    return (p.iy == pos && p.ix >= start && p.ix <= end);
+  else
+    return (p.ix == pos && p.iy >= start && p.iy <= end);
+}
+
+TilePosition
+TileLine::
+startPos() const
+{
+  if (direction == Direction::HORIZONTAL)
+    return TilePosition(start, pos);
+  else
+    return TilePosition(pos, start);
+}
+
+bool
+TileLine::
+isValid(LineValid &lineValid) const
+{
+  lineValid.partial = false;
+  lineValid.error   = ErrorCode::NONE;
+
+  if (len() > 5) {
+    lineValid.error = ErrorCode::LINE_TOO_LONG;
+    return false;
+  }
+
+  //---
+
+  if ((sum % 5) != 0) {
+    if (len() == 5) {
+      lineValid.error = ErrorCode::NOT_MULTIPLE_5;
+      return false;
+    }
+
+    lineValid.partial = true;
+    lineValid.error   = ErrorCode::NOT_MULTIPLE_5_YET;
+  }
+
+  return true;
+}
+
+void
+TileLine::
+print(std::ostream &os) const
+{
+  if (direction == Direction::HORIZONTAL)
+    os << "H: (" << start << "," << pos << ") (" << end << ") = " << sum;
+  else
+    os << "V: (" << pos << "," << start << ") (" << end << ") = " << sum;
+}
+
+void
+TileLine::
+print(std::ostream &os, ErrorCode error) const
+{
+  print(os);
+
+  if (error != ErrorCode::NONE)
+    os << " (" << errorText(error) << ")";
+}
+
+//------
+
+void
+BoardDetails::
+reset()
+{
+  valid = false;
+  score = 0;
+  error = ErrorCode::NONE;
+
+  validPositions.clear();
+}
+
+void
+BoardDetails::
+addValidPosition(const TilePosition &pos)
+{
+  validPositions.insert(pos);
+}
+
+//------
+
+void
+SearchStats::
+print(std::ostream &os) const
+{
+  os << "nodes=" << nodes << " leaves=" << leaves << " depth=" << maxDepth <<
+        " pruned=" << pruned << " duplicates=" << duplicates <<
+        " bounded=" << bounded;
+
+  if (tasks > 0)
+    os << " tasks=" << tasks << " steals=" << steals;
+
+  os << " time=" << time*1000.0 << "ms nodes/s=" << int(nodesPerSec());
+}
+
+//------
+
+MoveTree::
+MoveTree()
+{
+}
+
+MoveTree::
+~MoveTree()
+{
+  for (auto &child : children)
+    delete child;
+}
+
+const MoveTree *
+MoveTree::
+maxLeaf() const
+{
+  ScoreTree scoreTree;
+
+  updateScoreTree(scoreTree);
+
+  if (scoreTree.empty())
+    return nullptr;
+
+  //---
+
+#if 0
+  for (const auto &st : scoreTree) {
+    std::cerr << "Score=" << -st.first << "\n";
+
+    for (const auto &t : st.second) {
+      Moves moves;
+
+      t->hierMoves(moves);
+
+      std::cerr << " ";
+
+      for (const auto &move : moves) {
+        std::cerr << " ";
+
+        move.print(std::cerr);
+      }
+
+      std::cerr << "\n";
+    }
+  }
+#endif
+
+  //---
+
+  const MoveTrees &moveTrees = scoreTree.begin()->second;
+
+  int nt = moveTrees.size();
+  //assert(nt > 0);
+
+  auto minTree = moveTrees[0];
+
+  if (nt == 1)
+    return minTree;
+
+  // best is min or max depth ?
+  auto minDepth = minTree->depth();
+
+  for (int i = 1; i < nt; ++i) {
+    auto tree = moveTrees[i];
+
+    auto depth = tree->depth();
+
+    if (depth < minDepth) {
+      minDepth = depth;
+      minTree  = tree;
+    }
+  }
+
+  return minTree;
+}
+
+void
+MoveTree::
+updateScoreTree(ScoreTree &scoreTree) const
+{
+  // add tree if valid and not partial (non multiple of 5)
+  if (! partial) {
+    //assert((score % 5) == 0);
+
+    scoreTree[-score].push_back(this);
+  }
+
+  if (! children.empty()) {
+    for (const auto &child : children)
+      child->updateScoreTree(scoreTree);
+  }
+}
+
+int
+MoveTree::
+depth() const
+{
+  if (! parent)
+    return 1;
+
+  return parent->depth() + 1;
+}
+
+int
+MoveTree::
+size() const
+{
+  int s = 1;
+
+  for (const auto &child : children)
+    s += child->size();
+
+  return s;
+}
+
+void
+MoveTree::
+hierMoves(Moves &moves) const
+{
+  // get move parent stack
+  moves.push_back(move);
+
+  auto parent = this->parent;
+
+  while (parent) {
+    if (parent->move.isValid())
+      moves.push_back(parent->move);
+
+    parent = parent->parent;
+  }
+
+  // reverse as in wrong order
+  int nm = moves.size();
+
+  for (int i = 0; i < nm/2; ++i)
+    std::swap(moves[i], moves[nm - i - 1]);
+}
+
+void
+MoveTree::
+printDepth(std::ostream &os, int depth) const
+{
+  if (move.isValid()) {
+    os << "{";
+
+    move.print(os);
+
+    os << "}";
+  }
+
+  if (! children.empty()) {
+    os << "\n";
+
+    for (int i = 0; i < depth; ++i)
+      os << " ";
+
+    bool first = true;
+
+    os << "[";
+
+    for (const auto &child : children) {
+      if (! first)
+        os << " ";
+
+      child->printDepth(os, depth + 1);
+
+      first = false;
+    }
+
+    os << "]";
+  }
+
+  os << "@" << score;
+}
+
+void
+MoveTree::
+print(std::ostream &os) const
+{
+  printDepth(os, 0);
+}
+
+//------
+
+Turn::
+Turn(Game *game, int ind) :
+ game_(game), ind_(ind)
+{
+}
+
+int
+Turn::
+score() const
+{
+  auto score = 0;
+
+  for (const auto &move : moves())
+    score += game_->moveScore(move);
+
+  return score;
+}
+
+//------
+
+}
@@ -0,0 +1,39 @@
+TEMPLATE = lib
+
+TARGET = CQuintoEngine
+
+CONFIG += staticlib
+CONFIG -= qt
+CONFIG += thread
+
+DEPENDPATH += .
+
+QMAKE_CXXFLAGS += -std=c++17
+
+#CONFIG += debug
+
+# Input
+SOURCES += \
+CQuintoEngine.cpp \
+CQuintoOpening.cpp \
+CQuintoOpeningData.cpp \
+CQuintoPosition.cpp \
+CQuintoRecord.cpp \
+CQuintoSearch.cpp \
+CQuintoThreadPool.cpp \
+
+HEADERS += \
+../include/CQuintoBitBoard.h \
+../include/CQuintoEngine.h \
+../include/CQuintoOpening.h \
+../include/CQuintoPosition.h \
+../include/CQuintoRecord.h \
+../include/CQuintoSearch.h \
+../include/CQuintoThreadPool.h \
+
+DESTDIR     = ../lib
+OBJECTS_DIR = ../obj
+
+INCLUDEPATH += \
+../include \
+.
@@ -0,0 +1,63 @@
+#include <CQuintoOpening.h>
+
+#include <algorithm>
+
+namespace CQuinto {
+
+// generated table (sorted by key)
+extern const OpeningEntry s_openingEntries[];
+extern const int          s_numOpeningEntries;
+
+uint32_t
+OpeningTable::
+handKey(const int *values, int n)
+{
+  int sorted[HAND_SIZE];
+  int ns = 0;
+
+  for (int i = 0; i < n && ns < HAND_SIZE; ++i)
+    if (values[i] >= 0)
+      sorted[ns++] = values[i];
+
+  std::sort(sorted, sorted + ns);
+
+  // leading 1 so number of tiles is part of key
+  uint32_t key = 1;
+
+  for (int i = 0; i < ns; ++i)
+    key = key*10 + uint32_t(sorted[i]);
+
+  return key;
+}
+
+const OpeningEntry *
+OpeningTable::
+find(uint32_t key)
+{
+  auto *begin = s_openingEntries;
+  auto *end   = s_openingEntries + s_numOpeningEntries;
+
+  auto *entry = std::lower_bound(begin, end, key,
+    [](const OpeningEntry &entry, uint32_t key) { return entry.key < key; });
+
+  if (entry == end || entry->key != key)
+    return nullptr;
+
+  return entry;
+}
+
+int
+OpeningTable::
+numEntries()
+{
+  return s_numOpeningEntries;
+}
+
+const OpeningEntry &
+OpeningTable::
+entry(int i)
+{
+  return s_openingEntries[i];
+}
+
+}
@@ -0,0 +1,2014 @@
+#include <CQuintoOpening.h>
+
+// generated by CQuintoOpening -generate (do not edit)
+
+namespace CQuinto {
+
+extern const OpeningEntry s_openingEntries[] = {
+  { 100000, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100001, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100002, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100003, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100004, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100005, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100006, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100007, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100008, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100009, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100011, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100012, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100013, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100014, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100015, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100016, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100017, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100018, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100019, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100022, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100023, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100024, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100025, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100026, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100027, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100028, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100029, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100033, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100034, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100035, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100036, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100037, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100038, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100039, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100044, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100045, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100046, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100047, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100048, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100049, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100055, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100056, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100057, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100058, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100059, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100066, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100067, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100068, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100069, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100077, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100078, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100079, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100088, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100089, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100099, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100111, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100112, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100113, 5, 3, {98,97,96,0,0}, {1,1,3,0,0} },
+  { 100114, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100115, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100116, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100117, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100118, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 100119, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100122, 5, 3, {98,97,96,0,0}, {1,2,2,0,0} },
+  { 100123, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100124, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100125, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100126, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100127, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 100128, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100129, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100133, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100134, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100135, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100136, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 100137, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100138, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100139, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100144, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100145, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100146, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100147, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100148, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 100149, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100155, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100156, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100157, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100158, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100159, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 100166, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100167, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100168, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 100169, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100177, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 100178, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100179, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100188, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100189, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100199, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 100222, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100223, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100224, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100225, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100226, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 100227, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100228, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100229, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100233, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100234, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100235, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100236, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100237, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100238, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100239, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 100244, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 100245, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100246, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100247, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100248, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100249, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 100255, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100256, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100257, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100258, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 100259, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100266, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100267, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 100268, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100269, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100277, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100278, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100279, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100288, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100289, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 100299, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 100333, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 100335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100336, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100337, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100338, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 100344, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100345, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100346, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100347, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 100349, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100355, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100356, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 100358, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100359, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 100367, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100368, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100369, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100377, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100378, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100379, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 100388, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 100399, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100444, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100446, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 100448, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100449, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 100457, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100458, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100459, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100466, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100467, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100468, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 100469, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100477, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100478, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 100488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 100489, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100499, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 100556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100567, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100568, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 100577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 100579, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100589, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 100666, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100667, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 100669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 100678, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100679, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100688, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100689, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100699, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 100777, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100779, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100788, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100789, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 100799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 100888, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 100899, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 100999, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 101111, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 101112, 5, 4, {98,97,96,95,0}, {1,1,1,2,0} },
+  { 101113, 5, 3, {98,97,96,0,0}, {1,1,3,0,0} },
+  { 101114, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101115, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101116, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 101117, 10, 4, {98,97,96,95,0}, {1,1,1,7,0} },
+  { 101118, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 101119, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101122, 5, 3, {98,97,96,0,0}, {1,2,2,0,0} },
+  { 101123, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 101124, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101125, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101126, 10, 4, {98,97,96,95,0}, {1,1,2,6,0} },
+  { 101127, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 101128, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 101129, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101133, 5, 3, {98,97,96,0,0}, {1,1,3,0,0} },
+  { 101134, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101135, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101136, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 101137, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 101138, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 101139, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101144, 10, 4, {98,97,96,95,0}, {1,1,4,4,0} },
+  { 101145, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101146, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 101147, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101148, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 101149, 15, 4, {98,97,96,95,0}, {1,1,4,9,0} },
+  { 101155, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101156, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101157, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101158, 15, 4, {98,97,96,95,0}, {1,1,5,8,0} },
+  { 101159, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101166, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 101167, 15, 4, {98,97,96,95,0}, {1,1,6,7,0} },
+  { 101168, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 101169, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 101177, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 101178, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 101179, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101188, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 101189, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101199, 20, 4, {98,97,96,95,0}, {1,1,9,9,0} },
+  { 101222, 5, 3, {98,97,96,0,0}, {1,2,2,0,0} },
+  { 101223, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 101224, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101225, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101226, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 101227, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 101228, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 101229, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101233, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 101234, 10, 4, {98,97,96,95,0}, {1,2,3,4,0} },
+  { 101235, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101236, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 101237, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 101238, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 101239, 15, 4, {98,97,96,95,0}, {1,2,3,9,0} },
+  { 101244, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 101245, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101246, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 101247, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 101248, 15, 4, {98,97,96,95,0}, {1,2,4,8,0} },
+  { 101249, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 101255, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101256, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101257, 15, 4, {98,97,96,95,0}, {1,2,5,7,0} },
+  { 101258, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 101259, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101266, 15, 4, {98,97,96,95,0}, {1,2,6,6,0} },
+  { 101267, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 101268, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 101269, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 101277, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 101278, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 101279, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101288, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 101289, 20, 4, {98,97,96,95,0}, {1,2,8,9,0} },
+  { 101299, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 101333, 10, 4, {98,97,96,95,0}, {1,3,3,3,0} },
+  { 101334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 101335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101336, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 101337, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 101338, 15, 4, {98,97,96,95,0}, {1,3,3,8,0} },
+  { 101339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 101344, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101345, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101346, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 101347, 15, 4, {98,97,96,95,0}, {1,3,4,7,0} },
+  { 101348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 101349, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101355, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101356, 15, 4, {98,97,96,95,0}, {1,3,5,6,0} },
+  { 101357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 101358, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101359, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 101367, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 101368, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 101369, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 101377, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 101378, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 101379, 20, 4, {98,97,96,95,0}, {1,3,7,9,0} },
+  { 101388, 20, 4, {98,97,96,95,0}, {1,3,8,8,0} },
+  { 101389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 101399, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101444, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101446, 15, 4, {98,97,96,95,0}, {1,4,4,6,0} },
+  { 101447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 101448, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 101449, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101455, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 101456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 101457, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101458, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101459, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101466, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 101467, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 101468, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 101469, 20, 4, {98,97,96,95,0}, {1,4,6,9,0} },
+  { 101477, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 101478, 20, 4, {98,97,96,95,0}, {1,4,7,8,0} },
+  { 101479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 101488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 101489, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101499, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 101556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101559, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 101566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101567, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101568, 20, 4, {98,97,96,95,0}, {1,5,6,8,0} },
+  { 101569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 101577, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 101578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 101579, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 101589, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101599, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 101666, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 101667, 20, 4, {98,97,96,95,0}, {1,6,6,7,0} },
+  { 101668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 101669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 101677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 101678, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 101679, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 101688, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 101689, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 101699, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 101777, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 101778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 101779, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 101788, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 101789, 25, 4, {98,97,96,95,0}, {1,7,8,9,0} },
+  { 101799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 101888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 101889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 101899, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 101999, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 102222, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 102223, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 102224, 10, 4, {98,97,96,95,0}, {2,2,2,4,0} },
+  { 102225, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102226, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 102227, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 102228, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102229, 15, 4, {98,97,96,95,0}, {2,2,2,9,0} },
+  { 102233, 10, 4, {98,97,96,95,0}, {2,2,3,3,0} },
+  { 102234, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 102235, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102236, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 102237, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 102238, 15, 4, {98,97,96,95,0}, {2,2,3,8,0} },
+  { 102239, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 102244, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 102245, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102246, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 102247, 15, 4, {98,97,96,95,0}, {2,2,4,7,0} },
+  { 102248, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102249, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 102255, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102256, 15, 4, {98,97,96,95,0}, {2,2,5,6,0} },
+  { 102257, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102258, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 102259, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102266, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 102267, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 102268, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102269, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 102277, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 102278, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 102279, 20, 4, {98,97,96,95,0}, {2,2,7,9,0} },
+  { 102288, 20, 4, {98,97,96,95,0}, {2,2,8,8,0} },
+  { 102289, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102299, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 102333, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 102334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 102335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102336, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 102337, 15, 4, {98,97,96,95,0}, {2,3,3,7,0} },
+  { 102338, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 102344, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 102345, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102346, 15, 4, {98,97,96,95,0}, {2,3,4,6,0} },
+  { 102347, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 102348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 102349, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 102355, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 102356, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 102358, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 102359, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 102367, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 102368, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102369, 20, 4, {98,97,96,95,0}, {2,3,6,9,0} },
+  { 102377, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 102378, 20, 4, {98,97,96,95,0}, {2,3,7,8,0} },
+  { 102379, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 102388, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 102399, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 102444, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 102445, 15, 4, {98,97,96,95,0}, {2,4,4,5,0} },
+  { 102446, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 102447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 102448, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102449, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 102455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 102457, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102458, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 102459, 20, 4, {98,97,96,95,0}, {2,4,5,9,0} },
+  { 102466, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 102467, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 102468, 20, 4, {98,97,96,95,0}, {2,4,6,8,0} },
+  { 102469, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 102477, 20, 4, {98,97,96,95,0}, {2,4,7,7,0} },
+  { 102478, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 102479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 102488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 102489, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 102499, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 102555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 102556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102558, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 102559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102567, 20, 4, {98,97,96,95,0}, {2,5,6,7,0} },
+  { 102568, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 102569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 102577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 102579, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 102588, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 102589, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 102599, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 102666, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 102667, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 102668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 102669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 102677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 102678, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 102679, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 102688, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102689, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 102699, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 102777, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 102778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 102779, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 102788, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 102789, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 102799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 102888, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 102889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 102899, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 102999, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 103333, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 103334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 103335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103336, 15, 4, {98,97,96,95,0}, {3,3,3,6,0} },
+  { 103337, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 103338, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 103339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 103344, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 103345, 15, 4, {98,97,96,95,0}, {3,3,4,5,0} },
+  { 103346, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 103347, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 103348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 103349, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 103355, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103356, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 103358, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103359, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 103366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 103367, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 103368, 20, 4, {98,97,96,95,0}, {3,3,6,8,0} },
+  { 103369, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 103377, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 103378, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 103379, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 103388, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 103389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 103399, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 103444, 15, 4, {98,97,96,95,0}, {3,4,4,4,0} },
+  { 103445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103446, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 103447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 103448, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 103449, 20, 4, {98,97,96,95,0}, {3,4,4,9,0} },
+  { 103455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 103457, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 103458, 20, 4, {98,97,96,95,0}, {3,4,5,8,0} },
+  { 103459, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103466, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 103467, 20, 4, {98,97,96,95,0}, {3,4,6,7,0} },
+  { 103468, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 103469, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 103477, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 103478, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 103479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 103488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 103489, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 103499, 25, 4, {98,97,96,95,0}, {3,4,9,9,0} },
+  { 103555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 103556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103557, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 103558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103566, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 103567, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 103568, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 103577, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 103578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 103579, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 103588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103589, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 103599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 103666, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 103667, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 103668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 103669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 103677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 103678, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 103679, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 103688, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 103689, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 103699, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 103777, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 103778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 103779, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 103788, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 103789, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 103799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 103888, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 103889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 103899, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 103999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 104444, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 104445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104446, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 104447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 104448, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 104449, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 104455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 104457, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 104458, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104459, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104466, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 104467, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 104468, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 104469, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 104477, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 104478, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 104479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 104488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 104489, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 104499, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 104555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 104556, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 104557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104566, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 104567, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 104568, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 104569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 104577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 104579, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 104588, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 104589, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 104666, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 104667, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 104668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 104669, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 104677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 104678, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 104679, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 104688, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 104689, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 104699, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 104777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 104778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 104779, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 104788, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 104789, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 104799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 104888, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 104889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 104899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 104999, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 105555, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 105556, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 105557, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 105558, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 105559, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 105566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105567, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105568, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105569, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 105577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105578, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 105579, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105589, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105666, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105667, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105668, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 105669, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 105677, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 105678, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 105679, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 105688, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105689, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 105699, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 105777, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105778, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 105779, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105788, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 105789, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 105799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 105888, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 105899, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 105999, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 106666, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 106667, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 106668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 106669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 106677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 106678, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 106679, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 106688, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 106689, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 106699, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 106777, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 106778, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 106779, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 106788, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 106789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 106799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 106888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 106889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 106899, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 106999, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 107777, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 107778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 107779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 107788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 107789, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 107799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 107888, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 107889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 107899, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 107999, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 108888, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 108889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 108899, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 108999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 109999, 0, 1, {98,0,0,0,0}, {0,0,0,0,0} },
+  { 111111, 5, 5, {98,97,96,95,94}, {1,1,1,1,1} },
+  { 111112, 5, 4, {98,97,96,95,0}, {1,1,1,2,0} },
+  { 111113, 5, 3, {98,97,96,0,0}, {1,1,3,0,0} },
+  { 111114, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 111115, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111116, 10, 5, {98,97,96,95,94}, {1,1,1,1,6} },
+  { 111117, 10, 4, {98,97,96,95,0}, {1,1,1,7,0} },
+  { 111118, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 111119, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 111122, 5, 3, {98,97,96,0,0}, {1,2,2,0,0} },
+  { 111123, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 111124, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 111125, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111126, 10, 4, {98,97,96,95,0}, {1,1,2,6,0} },
+  { 111127, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 111128, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 111129, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 111133, 5, 3, {98,97,96,0,0}, {1,1,3,0,0} },
+  { 111134, 10, 5, {98,97,96,95,94}, {1,1,1,3,4} },
+  { 111135, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111136, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 111137, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 111138, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 111139, 15, 5, {98,97,96,95,94}, {1,1,1,3,9} },
+  { 111144, 10, 4, {98,97,96,95,0}, {1,1,4,4,0} },
+  { 111145, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111146, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 111147, 10, 4, {98,97,96,95,0}, {1,1,1,7,0} },
+  { 111148, 15, 5, {98,97,96,95,94}, {1,1,1,4,8} },
+  { 111149, 15, 4, {98,97,96,95,0}, {1,1,4,9,0} },
+  { 111155, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111156, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111157, 15, 5, {98,97,96,95,94}, {1,1,1,5,7} },
+  { 111158, 15, 4, {98,97,96,95,0}, {1,1,5,8,0} },
+  { 111159, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 111166, 15, 5, {98,97,96,95,94}, {1,1,1,6,6} },
+  { 111167, 15, 4, {98,97,96,95,0}, {1,1,6,7,0} },
+  { 111168, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 111169, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 111177, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 111178, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 111179, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 111188, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 111189, 20, 5, {98,97,96,95,94}, {1,1,1,8,9} },
+  { 111199, 20, 4, {98,97,96,95,0}, {1,1,9,9,0} },
+  { 111222, 5, 3, {98,97,96,0,0}, {1,2,2,0,0} },
+  { 111223, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 111224, 10, 5, {98,97,96,95,94}, {1,1,2,2,4} },
+  { 111225, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111226, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 111227, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 111228, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 111229, 15, 5, {98,97,96,95,94}, {1,1,2,2,9} },
+  { 111233, 10, 5, {98,97,96,95,94}, {1,1,2,3,3} },
+  { 111234, 10, 4, {98,97,96,95,0}, {1,2,3,4,0} },
+  { 111235, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111236, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 111237, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 111238, 15, 5, {98,97,96,95,94}, {1,1,2,3,8} },
+  { 111239, 15, 4, {98,97,96,95,0}, {1,2,3,9,0} },
+  { 111244, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 111245, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111246, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 111247, 15, 5, {98,97,96,95,94}, {1,1,2,4,7} },
+  { 111248, 15, 4, {98,97,96,95,0}, {1,2,4,8,0} },
+  { 111249, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 111255, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111256, 15, 5, {98,97,96,95,94}, {1,1,2,5,6} },
+  { 111257, 15, 4, {98,97,96,95,0}, {1,2,5,7,0} },
+  { 111258, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 111259, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 111266, 15, 4, {98,97,96,95,0}, {1,2,6,6,0} },
+  { 111267, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 111268, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 111269, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 111277, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 111278, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 111279, 20, 5, {98,97,96,95,94}, {1,1,2,7,9} },
+  { 111288, 20, 5, {98,97,96,95,94}, {1,1,2,8,8} },
+  { 111289, 20, 4, {98,97,96,95,0}, {1,2,8,9,0} },
+  { 111299, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 111333, 10, 4, {98,97,96,95,0}, {1,3,3,3,0} },
+  { 111334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 111335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111336, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 111337, 15, 5, {98,97,96,95,94}, {1,1,3,3,7} },
+  { 111338, 15, 4, {98,97,96,95,0}, {1,3,3,8,0} },
+  { 111339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 111344, 10, 4, {98,97,96,95,0}, {1,1,4,4,0} },
+  { 111345, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111346, 15, 5, {98,97,96,95,94}, {1,1,3,4,6} },
+  { 111347, 15, 4, {98,97,96,95,0}, {1,3,4,7,0} },
+  { 111348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 111349, 15, 4, {98,97,96,95,0}, {1,1,4,9,0} },
+  { 111355, 15, 5, {98,97,96,95,94}, {1,1,3,5,5} },
+  { 111356, 15, 4, {98,97,96,95,0}, {1,3,5,6,0} },
+  { 111357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 111358, 15, 4, {98,97,96,95,0}, {1,1,5,8,0} },
+  { 111359, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 111366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 111367, 15, 4, {98,97,96,95,0}, {1,1,6,7,0} },
+  { 111368, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 111369, 20, 5, {98,97,96,95,94}, {1,1,3,6,9} },
+  { 111377, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 111378, 20, 5, {98,97,96,95,94}, {1,1,3,7,8} },
+  { 111379, 20, 4, {98,97,96,95,0}, {1,3,7,9,0} },
+  { 111388, 20, 4, {98,97,96,95,0}, {1,3,8,8,0} },
+  { 111389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 111399, 20, 4, {98,97,96,95,0}, {1,1,9,9,0} },
+  { 111444, 10, 4, {98,97,96,95,0}, {1,1,4,4,0} },
+  { 111445, 15, 5, {98,97,96,95,94}, {1,1,4,4,5} },
+  { 111446, 15, 4, {98,97,96,95,0}, {1,4,4,6,0} },
+  { 111447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 111448, 10, 3, {98,97,96,0,0}, {1,1,8,0,0} },
+  { 111449, 15, 4, {98,97,96,95,0}, {1,1,4,9,0} },
+  { 111455, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 111456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 111457, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111458, 15, 4, {98,97,96,95,0}, {1,1,5,8,0} },
+  { 111459, 20, 5, {98,97,96,95,94}, {1,1,4,5,9} },
+  { 111466, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 111467, 15, 4, {98,97,96,95,0}, {1,1,6,7,0} },
+  { 111468, 20, 5, {98,97,96,95,94}, {1,1,4,6,8} },
+  { 111469, 20, 4, {98,97,96,95,0}, {1,4,6,9,0} },
+  { 111477, 20, 5, {98,97,96,95,94}, {1,1,4,7,7} },
+  { 111478, 20, 4, {98,97,96,95,0}, {1,4,7,8,0} },
+  { 111479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 111488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 111489, 15, 4, {98,97,96,95,0}, {1,1,4,9,0} },
+  { 111499, 20, 4, {98,97,96,95,0}, {1,1,9,9,0} },
+  { 111555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 111556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111558, 20, 5, {98,97,96,95,94}, {1,1,5,5,8} },
+  { 111559, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 111566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 111567, 20, 5, {98,97,96,95,94}, {1,1,5,6,7} },
+  { 111568, 20, 4, {98,97,96,95,0}, {1,5,6,8,0} },
+  { 111569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 111577, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 111578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 111579, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 111588, 15, 4, {98,97,96,95,0}, {1,1,5,8,0} },
+  { 111589, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 111599, 25, 5, {98,97,96,95,94}, {1,1,5,9,9} },
+  { 111666, 20, 5, {98,97,96,95,94}, {1,1,6,6,6} },
+  { 111667, 20, 4, {98,97,96,95,0}, {1,6,6,7,0} },
+  { 111668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 111669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 111677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 111678, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 111679, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 111688, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 111689, 25, 5, {98,97,96,95,94}, {1,1,6,8,9} },
+  { 111699, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 111777, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 111778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 111779, 25, 5, {98,97,96,95,94}, {1,1,7,7,9} },
+  { 111788, 25, 5, {98,97,96,95,94}, {1,1,7,8,8} },
+  { 111789, 25, 4, {98,97,96,95,0}, {1,7,8,9,0} },
+  { 111799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 111888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 111889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 111899, 20, 4, {98,97,96,95,0}, {1,1,9,9,0} },
+  { 111999, 20, 4, {98,97,96,95,0}, {1,1,9,9,0} },
+  { 112222, 5, 3, {98,97,96,0,0}, {1,2,2,0,0} },
+  { 112223, 10, 5, {98,97,96,95,94}, {1,2,2,2,3} },
+  { 112224, 10, 4, {98,97,96,95,0}, {2,2,2,4,0} },
+  { 112225, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 112226, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 112227, 10, 3, {98,97,96,0,0}, {1,2,7,0,0} },
+  { 112228, 15, 5, {98,97,96,95,94}, {1,2,2,2,8} },
+  { 112229, 15, 4, {98,97,96,95,0}, {2,2,2,9,0} },
+  { 112233, 10, 4, {98,97,96,95,0}, {2,2,3,3,0} },
+  { 112234, 10, 4, {98,97,96,95,0}, {1,2,3,4,0} },
+  { 112235, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 112236, 10, 3, {98,97,96,0,0}, {1,3,6,0,0} },
+  { 112237, 15, 5, {98,97,96,95,94}, {1,2,2,3,7} },
+  { 112238, 15, 4, {98,97,96,95,0}, {2,2,3,8,0} },
+  { 112239, 15, 4, {98,97,96,95,0}, {1,2,3,9,0} },
+  { 112244, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 112245, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 112246, 15, 5, {98,97,96,95,94}, {1,2,2,4,6} },
+  { 112247, 15, 4, {98,97,96,95,0}, {2,2,4,7,0} },
+  { 112248, 15, 4, {98,97,96,95,0}, {1,2,4,8,0} },
+  { 112249, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 112255, 15, 5, {98,97,96,95,94}, {1,2,2,5,5} },
+  { 112256, 15, 4, {98,97,96,95,0}, {2,2,5,6,0} },
+  { 112257, 15, 4, {98,97,96,95,0}, {1,2,5,7,0} },
+  { 112258, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 112259, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 112266, 15, 4, {98,97,96,95,0}, {1,2,6,6,0} },
+  { 112267, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 112268, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 112269, 20, 5, {98,97,96,95,94}, {1,2,2,6,9} },
+  { 112277, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 112278, 20, 5, {98,97,96,95,94}, {1,2,2,7,8} },
+  { 112279, 20, 4, {98,97,96,95,0}, {2,2,7,9,0} },
+  { 112288, 20, 4, {98,97,96,95,0}, {2,2,8,8,0} },
+  { 112289, 20, 4, {98,97,96,95,0}, {1,2,8,9,0} },
+  { 112299, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 112333, 10, 4, {98,97,96,95,0}, {1,3,3,3,0} },
+  { 112334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 112335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 112336, 15, 5, {98,97,96,95,94}, {1,2,3,3,6} },
+  { 112337, 15, 4, {98,97,96,95,0}, {2,3,3,7,0} },
+  { 112338, 15, 4, {98,97,96,95,0}, {1,3,3,8,0} },
+  { 112339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 112344, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 112345, 15, 5, {98,97,96,95,94}, {1,2,3,4,5} },
+  { 112346, 15, 4, {98,97,96,95,0}, {2,3,4,6,0} },
+  { 112347, 15, 4, {98,97,96,95,0}, {1,3,4,7,0} },
+  { 112348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 112349, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 112355, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 112356, 15, 4, {98,97,96,95,0}, {1,3,5,6,0} },
+  { 112357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 112358, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 112359, 20, 5, {98,97,96,95,94}, {1,2,3,5,9} },
+  { 112366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 112367, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 112368, 20, 5, {98,97,96,95,94}, {1,2,3,6,8} },
+  { 112369, 20, 4, {98,97,96,95,0}, {2,3,6,9,0} },
+  { 112377, 20, 5, {98,97,96,95,94}, {1,2,3,7,7} },
+  { 112378, 20, 4, {98,97,96,95,0}, {2,3,7,8,0} },
+  { 112379, 20, 4, {98,97,96,95,0}, {1,3,7,9,0} },
+  { 112388, 20, 4, {98,97,96,95,0}, {1,3,8,8,0} },
+  { 112389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 112399, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 112444, 15, 5, {98,97,96,95,94}, {1,2,4,4,4} },
+  { 112445, 15, 4, {98,97,96,95,0}, {2,4,4,5,0} },
+  { 112446, 15, 4, {98,97,96,95,0}, {1,4,4,6,0} },
+  { 112447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 112448, 15, 4, {98,97,96,95,0}, {1,2,4,8,0} },
+  { 112449, 20, 5, {98,97,96,95,94}, {1,2,4,4,9} },
+  { 112455, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 112456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 112457, 15, 4, {98,97,96,95,0}, {1,2,5,7,0} },
+  { 112458, 20, 5, {98,97,96,95,94}, {1,2,4,5,8} },
+  { 112459, 20, 4, {98,97,96,95,0}, {2,4,5,9,0} },
+  { 112466, 15, 4, {98,97,96,95,0}, {1,2,6,6,0} },
+  { 112467, 20, 5, {98,97,96,95,94}, {1,2,4,6,7} },
+  { 112468, 20, 4, {98,97,96,95,0}, {2,4,6,8,0} },
+  { 112469, 20, 4, {98,97,96,95,0}, {1,4,6,9,0} },
+  { 112477, 20, 4, {98,97,96,95,0}, {2,4,7,7,0} },
+  { 112478, 20, 4, {98,97,96,95,0}, {1,4,7,8,0} },
+  { 112479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 112488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 112489, 20, 4, {98,97,96,95,0}, {1,2,8,9,0} },
+  { 112499, 25, 5, {98,97,96,95,94}, {1,2,4,9,9} },
+  { 112555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 112556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 112557, 20, 5, {98,97,96,95,94}, {1,2,5,5,7} },
+  { 112558, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 112559, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 112566, 20, 5, {98,97,96,95,94}, {1,2,5,6,6} },
+  { 112567, 20, 4, {98,97,96,95,0}, {2,5,6,7,0} },
+  { 112568, 20, 4, {98,97,96,95,0}, {1,5,6,8,0} },
+  { 112569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 112577, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 112578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 112579, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 112588, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 112589, 25, 5, {98,97,96,95,94}, {1,2,5,8,9} },
+  { 112599, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 112666, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 112667, 20, 4, {98,97,96,95,0}, {1,6,6,7,0} },
+  { 112668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 112669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 112677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 112678, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 112679, 25, 5, {98,97,96,95,94}, {1,2,6,7,9} },
+  { 112688, 25, 5, {98,97,96,95,94}, {1,2,6,8,8} },
+  { 112689, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 112699, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 112777, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 112778, 25, 5, {98,97,96,95,94}, {1,2,7,7,8} },
+  { 112779, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 112788, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 112789, 25, 4, {98,97,96,95,0}, {1,7,8,9,0} },
+  { 112799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 112888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 112889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 112899, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 112999, 30, 5, {98,97,96,95,94}, {1,2,9,9,9} },
+  { 113333, 10, 4, {98,97,96,95,0}, {1,3,3,3,0} },
+  { 113334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 113335, 15, 5, {98,97,96,95,94}, {1,3,3,3,5} },
+  { 113336, 15, 4, {98,97,96,95,0}, {3,3,3,6,0} },
+  { 113337, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 113338, 15, 4, {98,97,96,95,0}, {1,3,3,8,0} },
+  { 113339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 113344, 15, 5, {98,97,96,95,94}, {1,3,3,4,4} },
+  { 113345, 15, 4, {98,97,96,95,0}, {3,3,4,5,0} },
+  { 113346, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 113347, 15, 4, {98,97,96,95,0}, {1,3,4,7,0} },
+  { 113348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 113349, 20, 5, {98,97,96,95,94}, {1,3,3,4,9} },
+  { 113355, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 113356, 15, 4, {98,97,96,95,0}, {1,3,5,6,0} },
+  { 113357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 113358, 20, 5, {98,97,96,95,94}, {1,3,3,5,8} },
+  { 113359, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 113366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 113367, 20, 5, {98,97,96,95,94}, {1,3,3,6,7} },
+  { 113368, 20, 4, {98,97,96,95,0}, {3,3,6,8,0} },
+  { 113369, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 113377, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 113378, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 113379, 20, 4, {98,97,96,95,0}, {1,3,7,9,0} },
+  { 113388, 20, 4, {98,97,96,95,0}, {1,3,8,8,0} },
+  { 113389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 113399, 25, 5, {98,97,96,95,94}, {1,3,3,9,9} },
+  { 113444, 15, 4, {98,97,96,95,0}, {3,4,4,4,0} },
+  { 113445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 113446, 15, 4, {98,97,96,95,0}, {1,4,4,6,0} },
+  { 113447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 113448, 20, 5, {98,97,96,95,94}, {1,3,4,4,8} },
+  { 113449, 20, 4, {98,97,96,95,0}, {3,4,4,9,0} },
+  { 113455, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 113456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 113457, 20, 5, {98,97,96,95,94}, {1,3,4,5,7} },
+  { 113458, 20, 4, {98,97,96,95,0}, {3,4,5,8,0} },
+  { 113459, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 113466, 20, 5, {98,97,96,95,94}, {1,3,4,6,6} },
+  { 113467, 20, 4, {98,97,96,95,0}, {3,4,6,7,0} },
+  { 113468, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 113469, 20, 4, {98,97,96,95,0}, {1,4,6,9,0} },
+  { 113477, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 113478, 20, 4, {98,97,96,95,0}, {1,4,7,8,0} },
+  { 113479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 113488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 113489, 25, 5, {98,97,96,95,94}, {1,3,4,8,9} },
+  { 113499, 25, 4, {98,97,96,95,0}, {3,4,9,9,0} },
+  { 113555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 113556, 20, 5, {98,97,96,95,94}, {1,3,5,5,6} },
+  { 113557, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 113558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 113559, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 113566, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 113567, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 113568, 20, 4, {98,97,96,95,0}, {1,5,6,8,0} },
+  { 113569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 113577, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 113578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 113579, 25, 5, {98,97,96,95,94}, {1,3,5,7,9} },
+  { 113588, 25, 5, {98,97,96,95,94}, {1,3,5,8,8} },
+  { 113589, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 113599, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 113666, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 113667, 20, 4, {98,97,96,95,0}, {1,6,6,7,0} },
+  { 113668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 113669, 25, 5, {98,97,96,95,94}, {1,3,6,6,9} },
+  { 113677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 113678, 25, 5, {98,97,96,95,94}, {1,3,6,7,8} },
+  { 113679, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 113688, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 113689, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 113699, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 113777, 25, 5, {98,97,96,95,94}, {1,3,7,7,7} },
+  { 113778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 113779, 20, 4, {98,97,96,95,0}, {1,3,7,9,0} },
+  { 113788, 20, 4, {98,97,96,95,0}, {1,3,8,8,0} },
+  { 113789, 25, 4, {98,97,96,95,0}, {1,7,8,9,0} },
+  { 113799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 113888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 113889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 113899, 30, 5, {98,97,96,95,94}, {1,3,8,9,9} },
+  { 113999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 114444, 5, 2, {98,97,0,0,0}, {1,4,0,0,0} },
+  { 114445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 114446, 15, 4, {98,97,96,95,0}, {1,4,4,6,0} },
+  { 114447, 20, 5, {98,97,96,95,94}, {1,4,4,4,7} },
+  { 114448, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 114449, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 114455, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 114456, 20, 5, {98,97,96,95,94}, {1,4,4,5,6} },
+  { 114457, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 114458, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 114459, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 114466, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 114467, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 114468, 15, 3, {98,97,96,0,0}, {1,6,8,0,0} },
+  { 114469, 20, 4, {98,97,96,95,0}, {1,4,6,9,0} },
+  { 114477, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 114478, 20, 4, {98,97,96,95,0}, {1,4,7,8,0} },
+  { 114479, 25, 5, {98,97,96,95,94}, {1,4,4,7,9} },
+  { 114488, 25, 5, {98,97,96,95,94}, {1,4,4,8,8} },
+  { 114489, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 114499, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 114555, 20, 5, {98,97,96,95,94}, {1,4,5,5,5} },
+  { 114556, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 114557, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 114558, 15, 4, {98,97,96,95,0}, {1,4,5,5,0} },
+  { 114559, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 114566, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 114567, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 114568, 20, 4, {98,97,96,95,0}, {1,5,6,8,0} },
+  { 114569, 25, 5, {98,97,96,95,94}, {1,4,5,6,9} },
+  { 114577, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 114578, 25, 5, {98,97,96,95,94}, {1,4,5,7,8} },
+  { 114579, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 114588, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 114589, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 114599, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 114666, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 114667, 20, 4, {98,97,96,95,0}, {1,6,6,7,0} },
+  { 114668, 25, 5, {98,97,96,95,94}, {1,4,6,6,8} },
+  { 114669, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 114677, 25, 5, {98,97,96,95,94}, {1,4,6,7,7} },
+  { 114678, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 114679, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 114688, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 114689, 20, 4, {98,97,96,95,0}, {1,4,6,9,0} },
+  { 114699, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 114777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 114778, 20, 4, {98,97,96,95,0}, {1,4,7,8,0} },
+  { 114779, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 114788, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 114789, 25, 4, {98,97,96,95,0}, {1,7,8,9,0} },
+  { 114799, 30, 5, {98,97,96,95,94}, {1,4,7,9,9} },
+  { 114888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 114889, 30, 5, {98,97,96,95,94}, {1,4,8,8,9} },
+  { 114899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 114999, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 115555, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 115556, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 115557, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 115558, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 115559, 25, 5, {98,97,96,95,94}, {1,5,5,5,9} },
+  { 115566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 115567, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 115568, 25, 5, {98,97,96,95,94}, {1,5,5,6,8} },
+  { 115569, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 115577, 25, 5, {98,97,96,95,94}, {1,5,5,7,7} },
+  { 115578, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 115579, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 115588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 115589, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 115599, 20, 4, {98,97,96,95,0}, {1,5,5,9,0} },
+  { 115666, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 115667, 25, 5, {98,97,96,95,94}, {1,5,6,6,7} },
+  { 115668, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 115669, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 115677, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 115678, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 115679, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 115688, 20, 4, {98,97,96,95,0}, {1,5,6,8,0} },
+  { 115689, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 115699, 30, 5, {98,97,96,95,94}, {1,5,6,9,9} },
+  { 115777, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 115778, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 115779, 20, 4, {98,97,96,95,0}, {1,5,7,7,0} },
+  { 115788, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 115789, 30, 5, {98,97,96,95,94}, {1,5,7,8,9} },
+  { 115799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 115888, 30, 5, {98,97,96,95,94}, {1,5,8,8,8} },
+  { 115889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 115899, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 115999, 15, 3, {98,97,96,0,0}, {1,5,9,0,0} },
+  { 116666, 25, 5, {98,97,96,95,94}, {1,6,6,6,6} },
+  { 116667, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 116668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 116669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 116677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 116678, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 116679, 20, 4, {98,97,96,95,0}, {1,6,6,7,0} },
+  { 116688, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 116689, 30, 5, {98,97,96,95,94}, {1,6,6,8,9} },
+  { 116699, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 116777, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 116778, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 116779, 30, 5, {98,97,96,95,94}, {1,6,7,7,9} },
+  { 116788, 30, 5, {98,97,96,95,94}, {1,6,7,8,8} },
+  { 116789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 116799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 116888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 116889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 116899, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 116999, 25, 4, {98,97,96,95,0}, {1,6,9,9,0} },
+  { 117777, 15, 3, {98,97,96,0,0}, {1,7,7,0,0} },
+  { 117778, 30, 5, {98,97,96,95,94}, {1,7,7,7,8} },
+  { 117779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 117788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 117789, 25, 4, {98,97,96,95,0}, {1,7,8,9,0} },
+  { 117799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 117888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 117889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 117899, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 117999, 35, 5, {98,97,96,95,94}, {1,7,9,9,9} },
+  { 118888, 25, 4, {98,97,96,95,0}, {1,8,8,8,0} },
+  { 118889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 118899, 35, 5, {98,97,96,95,94}, {1,8,8,9,9} },
+  { 118999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 119999, 10, 2, {98,97,0,0,0}, {1,9,0,0,0} },
+  { 122222, 10, 5, {98,97,96,95,94}, {2,2,2,2,2} },
+  { 122223, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 122224, 10, 4, {98,97,96,95,0}, {2,2,2,4,0} },
+  { 122225, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122226, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 122227, 15, 5, {98,97,96,95,94}, {2,2,2,2,7} },
+  { 122228, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 122229, 15, 4, {98,97,96,95,0}, {2,2,2,9,0} },
+  { 122233, 10, 4, {98,97,96,95,0}, {2,2,3,3,0} },
+  { 122234, 10, 4, {98,97,96,95,0}, {2,2,2,4,0} },
+  { 122235, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122236, 15, 5, {98,97,96,95,94}, {2,2,2,3,6} },
+  { 122237, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 122238, 15, 4, {98,97,96,95,0}, {2,2,3,8,0} },
+  { 122239, 15, 4, {98,97,96,95,0}, {2,2,2,9,0} },
+  { 122244, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 122245, 15, 5, {98,97,96,95,94}, {2,2,2,4,5} },
+  { 122246, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 122247, 15, 4, {98,97,96,95,0}, {2,2,4,7,0} },
+  { 122248, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 122249, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 122255, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122256, 15, 4, {98,97,96,95,0}, {2,2,5,6,0} },
+  { 122257, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122258, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 122259, 20, 5, {98,97,96,95,94}, {2,2,2,5,9} },
+  { 122266, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 122267, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 122268, 20, 5, {98,97,96,95,94}, {2,2,2,6,8} },
+  { 122269, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 122277, 20, 5, {98,97,96,95,94}, {2,2,2,7,7} },
+  { 122278, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 122279, 20, 4, {98,97,96,95,0}, {2,2,7,9,0} },
+  { 122288, 20, 4, {98,97,96,95,0}, {2,2,8,8,0} },
+  { 122289, 15, 4, {98,97,96,95,0}, {2,2,2,9,0} },
+  { 122299, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 122333, 10, 4, {98,97,96,95,0}, {2,2,3,3,0} },
+  { 122334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 122335, 15, 5, {98,97,96,95,94}, {2,2,3,3,5} },
+  { 122336, 10, 3, {98,97,96,0,0}, {2,2,6,0,0} },
+  { 122337, 15, 4, {98,97,96,95,0}, {2,3,3,7,0} },
+  { 122338, 15, 4, {98,97,96,95,0}, {2,2,3,8,0} },
+  { 122339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 122344, 15, 5, {98,97,96,95,94}, {2,2,3,4,4} },
+  { 122345, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122346, 15, 4, {98,97,96,95,0}, {2,3,4,6,0} },
+  { 122347, 15, 4, {98,97,96,95,0}, {2,2,4,7,0} },
+  { 122348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 122349, 20, 5, {98,97,96,95,94}, {2,2,3,4,9} },
+  { 122355, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 122356, 15, 4, {98,97,96,95,0}, {2,2,5,6,0} },
+  { 122357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 122358, 20, 5, {98,97,96,95,94}, {2,2,3,5,8} },
+  { 122359, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 122367, 20, 5, {98,97,96,95,94}, {2,2,3,6,7} },
+  { 122368, 15, 4, {98,97,96,95,0}, {2,2,3,8,0} },
+  { 122369, 20, 4, {98,97,96,95,0}, {2,3,6,9,0} },
+  { 122377, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 122378, 20, 4, {98,97,96,95,0}, {2,3,7,8,0} },
+  { 122379, 20, 4, {98,97,96,95,0}, {2,2,7,9,0} },
+  { 122388, 20, 4, {98,97,96,95,0}, {2,2,8,8,0} },
+  { 122389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 122399, 25, 5, {98,97,96,95,94}, {2,2,3,9,9} },
+  { 122444, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 122445, 15, 4, {98,97,96,95,0}, {2,4,4,5,0} },
+  { 122446, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 122447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 122448, 20, 5, {98,97,96,95,94}, {2,2,4,4,8} },
+  { 122449, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 122455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 122457, 20, 5, {98,97,96,95,94}, {2,2,4,5,7} },
+  { 122458, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 122459, 20, 4, {98,97,96,95,0}, {2,4,5,9,0} },
+  { 122466, 20, 5, {98,97,96,95,94}, {2,2,4,6,6} },
+  { 122467, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 122468, 20, 4, {98,97,96,95,0}, {2,4,6,8,0} },
+  { 122469, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 122477, 20, 4, {98,97,96,95,0}, {2,4,7,7,0} },
+  { 122478, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 122479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 122488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 122489, 25, 5, {98,97,96,95,94}, {2,2,4,8,9} },
+  { 122499, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 122555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 122556, 20, 5, {98,97,96,95,94}, {2,2,5,5,6} },
+  { 122557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122558, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 122559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122566, 15, 4, {98,97,96,95,0}, {2,2,5,6,0} },
+  { 122567, 20, 4, {98,97,96,95,0}, {2,5,6,7,0} },
+  { 122568, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 122569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 122577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 122578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 122579, 25, 5, {98,97,96,95,94}, {2,2,5,7,9} },
+  { 122588, 25, 5, {98,97,96,95,94}, {2,2,5,8,8} },
+  { 122589, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 122599, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 122666, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 122667, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 122668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 122669, 25, 5, {98,97,96,95,94}, {2,2,6,6,9} },
+  { 122677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 122678, 25, 5, {98,97,96,95,94}, {2,2,6,7,8} },
+  { 122679, 20, 4, {98,97,96,95,0}, {2,2,7,9,0} },
+  { 122688, 20, 4, {98,97,96,95,0}, {2,2,8,8,0} },
+  { 122689, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 122699, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 122777, 25, 5, {98,97,96,95,94}, {2,2,7,7,7} },
+  { 122778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 122779, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 122788, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 122789, 20, 4, {98,97,96,95,0}, {2,2,7,9,0} },
+  { 122799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 122888, 20, 4, {98,97,96,95,0}, {2,2,8,8,0} },
+  { 122889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 122899, 30, 5, {98,97,96,95,94}, {2,2,8,9,9} },
+  { 122999, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 123333, 5, 2, {98,97,0,0,0}, {2,3,0,0,0} },
+  { 123334, 15, 5, {98,97,96,95,94}, {2,3,3,3,4} },
+  { 123335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 123336, 15, 4, {98,97,96,95,0}, {3,3,3,6,0} },
+  { 123337, 15, 4, {98,97,96,95,0}, {2,3,3,7,0} },
+  { 123338, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 123339, 20, 5, {98,97,96,95,94}, {2,3,3,3,9} },
+  { 123344, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 123345, 15, 4, {98,97,96,95,0}, {3,3,4,5,0} },
+  { 123346, 15, 4, {98,97,96,95,0}, {2,3,4,6,0} },
+  { 123347, 15, 4, {98,97,96,95,0}, {2,3,3,7,0} },
+  { 123348, 20, 5, {98,97,96,95,94}, {2,3,3,4,8} },
+  { 123349, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 123355, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 123356, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 123357, 20, 5, {98,97,96,95,94}, {2,3,3,5,7} },
+  { 123358, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 123359, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 123366, 20, 5, {98,97,96,95,94}, {2,3,3,6,6} },
+  { 123367, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 123368, 20, 4, {98,97,96,95,0}, {3,3,6,8,0} },
+  { 123369, 20, 4, {98,97,96,95,0}, {2,3,6,9,0} },
+  { 123377, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 123378, 20, 4, {98,97,96,95,0}, {2,3,7,8,0} },
+  { 123379, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 123388, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 123389, 25, 5, {98,97,96,95,94}, {2,3,3,8,9} },
+  { 123399, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 123444, 15, 4, {98,97,96,95,0}, {3,4,4,4,0} },
+  { 123445, 15, 4, {98,97,96,95,0}, {2,4,4,5,0} },
+  { 123446, 15, 4, {98,97,96,95,0}, {2,3,4,6,0} },
+  { 123447, 20, 5, {98,97,96,95,94}, {2,3,4,4,7} },
+  { 123448, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 123449, 20, 4, {98,97,96,95,0}, {3,4,4,9,0} },
+  { 123455, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 123456, 20, 5, {98,97,96,95,94}, {2,3,4,5,6} },
+  { 123457, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 123458, 20, 4, {98,97,96,95,0}, {3,4,5,8,0} },
+  { 123459, 20, 4, {98,97,96,95,0}, {2,4,5,9,0} },
+  { 123466, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 123467, 20, 4, {98,97,96,95,0}, {3,4,6,7,0} },
+  { 123468, 20, 4, {98,97,96,95,0}, {2,4,6,8,0} },
+  { 123469, 20, 4, {98,97,96,95,0}, {2,3,6,9,0} },
+  { 123477, 20, 4, {98,97,96,95,0}, {2,4,7,7,0} },
+  { 123478, 20, 4, {98,97,96,95,0}, {2,3,7,8,0} },
+  { 123479, 25, 5, {98,97,96,95,94}, {2,3,4,7,9} },
+  { 123488, 25, 5, {98,97,96,95,94}, {2,3,4,8,8} },
+  { 123489, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 123499, 25, 4, {98,97,96,95,0}, {3,4,9,9,0} },
+  { 123555, 20, 5, {98,97,96,95,94}, {2,3,5,5,5} },
+  { 123556, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 123557, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 123558, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 123559, 15, 4, {98,97,96,95,0}, {2,3,5,5,0} },
+  { 123566, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 123567, 20, 4, {98,97,96,95,0}, {2,5,6,7,0} },
+  { 123568, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 123569, 25, 5, {98,97,96,95,94}, {2,3,5,6,9} },
+  { 123577, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 123578, 25, 5, {98,97,96,95,94}, {2,3,5,7,8} },
+  { 123579, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 123588, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 123589, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 123599, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 123666, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 123667, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 123668, 25, 5, {98,97,96,95,94}, {2,3,6,6,8} },
+  { 123669, 20, 4, {98,97,96,95,0}, {2,3,6,9,0} },
+  { 123677, 25, 5, {98,97,96,95,94}, {2,3,6,7,7} },
+  { 123678, 20, 4, {98,97,96,95,0}, {2,3,7,8,0} },
+  { 123679, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 123688, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 123689, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 123699, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 123777, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 123778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 123779, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 123788, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 123789, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 123799, 30, 5, {98,97,96,95,94}, {2,3,7,9,9} },
+  { 123888, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 123889, 30, 5, {98,97,96,95,94}, {2,3,8,8,9} },
+  { 123899, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 123999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 124444, 10, 3, {98,97,96,0,0}, {2,4,4,0,0} },
+  { 124445, 15, 4, {98,97,96,95,0}, {2,4,4,5,0} },
+  { 124446, 20, 5, {98,97,96,95,94}, {2,4,4,4,6} },
+  { 124447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 124448, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 124449, 15, 3, {98,97,96,0,0}, {2,4,9,0,0} },
+  { 124455, 20, 5, {98,97,96,95,94}, {2,4,4,5,5} },
+  { 124456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 124457, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 124458, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 124459, 20, 4, {98,97,96,95,0}, {2,4,5,9,0} },
+  { 124466, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 124467, 15, 3, {98,97,96,0,0}, {2,6,7,0,0} },
+  { 124468, 20, 4, {98,97,96,95,0}, {2,4,6,8,0} },
+  { 124469, 25, 5, {98,97,96,95,94}, {2,4,4,6,9} },
+  { 124477, 20, 4, {98,97,96,95,0}, {2,4,7,7,0} },
+  { 124478, 25, 5, {98,97,96,95,94}, {2,4,4,7,8} },
+  { 124479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 124488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 124489, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 124499, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 124555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 124556, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 124557, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 124558, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 124559, 25, 5, {98,97,96,95,94}, {2,4,5,5,9} },
+  { 124566, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 124567, 20, 4, {98,97,96,95,0}, {2,5,6,7,0} },
+  { 124568, 25, 5, {98,97,96,95,94}, {2,4,5,6,8} },
+  { 124569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 124577, 25, 5, {98,97,96,95,94}, {2,4,5,7,7} },
+  { 124578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 124579, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 124588, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 124589, 20, 4, {98,97,96,95,0}, {2,4,5,9,0} },
+  { 124599, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 124666, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 124667, 25, 5, {98,97,96,95,94}, {2,4,6,6,7} },
+  { 124668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 124669, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 124677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 124678, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 124679, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 124688, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 124689, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 124699, 30, 5, {98,97,96,95,94}, {2,4,6,9,9} },
+  { 124777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 124778, 20, 4, {98,97,96,95,0}, {2,4,7,7,0} },
+  { 124779, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 124788, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 124789, 30, 5, {98,97,96,95,94}, {2,4,7,8,9} },
+  { 124799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 124888, 30, 5, {98,97,96,95,94}, {2,4,8,8,8} },
+  { 124889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 124899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 124999, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 125555, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 125556, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 125557, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 125558, 25, 5, {98,97,96,95,94}, {2,5,5,5,8} },
+  { 125559, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 125566, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 125567, 25, 5, {98,97,96,95,94}, {2,5,5,6,7} },
+  { 125568, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 125569, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 125577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 125578, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 125579, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 125588, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 125589, 20, 4, {98,97,96,95,0}, {2,5,5,8,0} },
+  { 125599, 30, 5, {98,97,96,95,94}, {2,5,5,9,9} },
+  { 125666, 25, 5, {98,97,96,95,94}, {2,5,6,6,6} },
+  { 125667, 20, 4, {98,97,96,95,0}, {2,5,6,7,0} },
+  { 125668, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 125669, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 125677, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 125678, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 125679, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 125688, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 125689, 30, 5, {98,97,96,95,94}, {2,5,6,8,9} },
+  { 125699, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 125777, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 125778, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 125779, 30, 5, {98,97,96,95,94}, {2,5,7,7,9} },
+  { 125788, 30, 5, {98,97,96,95,94}, {2,5,7,8,8} },
+  { 125789, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 125799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 125888, 15, 3, {98,97,96,0,0}, {2,5,8,0,0} },
+  { 125889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 125899, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 125999, 25, 4, {98,97,96,95,0}, {2,5,9,9,0} },
+  { 126666, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 126667, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 126668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 126669, 20, 4, {98,97,96,95,0}, {2,6,6,6,0} },
+  { 126677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 126678, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 126679, 30, 5, {98,97,96,95,94}, {2,6,6,7,9} },
+  { 126688, 30, 5, {98,97,96,95,94}, {2,6,6,8,8} },
+  { 126689, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 126699, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 126777, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 126778, 30, 5, {98,97,96,95,94}, {2,6,7,7,8} },
+  { 126779, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 126788, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 126789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 126799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 126888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 126889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 126899, 25, 4, {98,97,96,95,0}, {2,6,8,9,0} },
+  { 126999, 35, 5, {98,97,96,95,94}, {2,6,9,9,9} },
+  { 127777, 30, 5, {98,97,96,95,94}, {2,7,7,7,7} },
+  { 127778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 127779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 127788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 127789, 25, 4, {98,97,96,95,0}, {2,7,7,9,0} },
+  { 127799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 127888, 25, 4, {98,97,96,95,0}, {2,7,8,8,0} },
+  { 127889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 127899, 35, 5, {98,97,96,95,94}, {2,7,8,9,9} },
+  { 127999, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 128888, 10, 2, {98,97,0,0,0}, {2,8,0,0,0} },
+  { 128889, 35, 5, {98,97,96,95,94}, {2,8,8,8,9} },
+  { 128899, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 128999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 129999, 20, 3, {98,97,96,0,0}, {2,9,9,0,0} },
+  { 133333, 15, 5, {98,97,96,95,94}, {3,3,3,3,3} },
+  { 133334, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 133335, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 133336, 15, 4, {98,97,96,95,0}, {3,3,3,6,0} },
+  { 133337, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 133338, 20, 5, {98,97,96,95,94}, {3,3,3,3,8} },
+  { 133339, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 133344, 10, 3, {98,97,96,0,0}, {3,3,4,0,0} },
+  { 133345, 15, 4, {98,97,96,95,0}, {3,3,4,5,0} },
+  { 133346, 15, 4, {98,97,96,95,0}, {3,3,3,6,0} },
+  { 133347, 20, 5, {98,97,96,95,94}, {3,3,3,4,7} },
+  { 133348, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 133349, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 133355, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 133356, 20, 5, {98,97,96,95,94}, {3,3,3,5,6} },
+  { 133357, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 133358, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 133359, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 133366, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 133367, 15, 4, {98,97,96,95,0}, {3,3,3,6,0} },
+  { 133368, 20, 4, {98,97,96,95,0}, {3,3,6,8,0} },
+  { 133369, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 133377, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 133378, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 133379, 25, 5, {98,97,96,95,94}, {3,3,3,7,9} },
+  { 133388, 25, 5, {98,97,96,95,94}, {3,3,3,8,8} },
+  { 133389, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 133399, 15, 3, {98,97,96,0,0}, {3,3,9,0,0} },
+  { 133444, 15, 4, {98,97,96,95,0}, {3,4,4,4,0} },
+  { 133445, 15, 4, {98,97,96,95,0}, {3,3,4,5,0} },
+  { 133446, 20, 5, {98,97,96,95,94}, {3,3,4,4,6} },
+  { 133447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 133448, 15, 3, {98,97,96,0,0}, {3,4,8,0,0} },
+  { 133449, 20, 4, {98,97,96,95,0}, {3,4,4,9,0} },
+  { 133455, 20, 5, {98,97,96,95,94}, {3,3,4,5,5} },
+  { 133456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 133457, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 133458, 20, 4, {98,97,96,95,0}, {3,4,5,8,0} },
+  { 133459, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 133466, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 133467, 20, 4, {98,97,96,95,0}, {3,4,6,7,0} },
+  { 133468, 20, 4, {98,97,96,95,0}, {3,3,6,8,0} },
+  { 133469, 25, 5, {98,97,96,95,94}, {3,3,4,6,9} },
+  { 133477, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 133478, 25, 5, {98,97,96,95,94}, {3,3,4,7,8} },
+  { 133479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 133488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 133489, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 133499, 25, 4, {98,97,96,95,0}, {3,4,9,9,0} },
+  { 133555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 133556, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 133557, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 133558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 133559, 25, 5, {98,97,96,95,94}, {3,3,5,5,9} },
+  { 133566, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 133567, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 133568, 25, 5, {98,97,96,95,94}, {3,3,5,6,8} },
+  { 133569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 133577, 25, 5, {98,97,96,95,94}, {3,3,5,7,7} },
+  { 133578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 133579, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 133588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 133589, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 133599, 20, 4, {98,97,96,95,0}, {3,3,5,9,0} },
+  { 133666, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 133667, 25, 5, {98,97,96,95,94}, {3,3,6,6,7} },
+  { 133668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 133669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 133677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 133678, 20, 4, {98,97,96,95,0}, {3,3,6,8,0} },
+  { 133679, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 133688, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 133689, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 133699, 30, 5, {98,97,96,95,94}, {3,3,6,9,9} },
+  { 133777, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 133778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 133779, 20, 4, {98,97,96,95,0}, {3,3,7,7,0} },
+  { 133788, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 133789, 30, 5, {98,97,96,95,94}, {3,3,7,8,9} },
+  { 133799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 133888, 30, 5, {98,97,96,95,94}, {3,3,8,8,8} },
+  { 133889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 133899, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 133999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 134444, 15, 4, {98,97,96,95,0}, {3,4,4,4,0} },
+  { 134445, 20, 5, {98,97,96,95,94}, {3,4,4,4,5} },
+  { 134446, 15, 4, {98,97,96,95,0}, {3,4,4,4,0} },
+  { 134447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 134448, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 134449, 20, 4, {98,97,96,95,0}, {3,4,4,9,0} },
+  { 134455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 134456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 134457, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 134458, 20, 4, {98,97,96,95,0}, {3,4,5,8,0} },
+  { 134459, 25, 5, {98,97,96,95,94}, {3,4,4,5,9} },
+  { 134466, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 134467, 20, 4, {98,97,96,95,0}, {3,4,6,7,0} },
+  { 134468, 25, 5, {98,97,96,95,94}, {3,4,4,6,8} },
+  { 134469, 20, 4, {98,97,96,95,0}, {3,4,4,9,0} },
+  { 134477, 25, 5, {98,97,96,95,94}, {3,4,4,7,7} },
+  { 134478, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 134479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 134488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 134489, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 134499, 25, 4, {98,97,96,95,0}, {3,4,9,9,0} },
+  { 134555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 134556, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 134557, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 134558, 25, 5, {98,97,96,95,94}, {3,4,5,5,8} },
+  { 134559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 134566, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 134567, 25, 5, {98,97,96,95,94}, {3,4,5,6,7} },
+  { 134568, 20, 4, {98,97,96,95,0}, {3,4,5,8,0} },
+  { 134569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 134577, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 134578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 134579, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 134588, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 134589, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 134599, 30, 5, {98,97,96,95,94}, {3,4,5,9,9} },
+  { 134666, 25, 5, {98,97,96,95,94}, {3,4,6,6,6} },
+  { 134667, 20, 4, {98,97,96,95,0}, {3,4,6,7,0} },
+  { 134668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 134669, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 134677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 134678, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 134679, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 134688, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 134689, 30, 5, {98,97,96,95,94}, {3,4,6,8,9} },
+  { 134699, 25, 4, {98,97,96,95,0}, {3,4,9,9,0} },
+  { 134777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 134778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 134779, 30, 5, {98,97,96,95,94}, {3,4,7,7,9} },
+  { 134788, 30, 5, {98,97,96,95,94}, {3,4,7,8,8} },
+  { 134789, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 134799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 134888, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 134889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 134899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 134999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 135555, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 135556, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 135557, 25, 5, {98,97,96,95,94}, {3,5,5,5,7} },
+  { 135558, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 135559, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 135566, 25, 5, {98,97,96,95,94}, {3,5,5,6,6} },
+  { 135567, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 135568, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 135569, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 135577, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 135578, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 135579, 20, 4, {98,97,96,95,0}, {3,5,5,7,0} },
+  { 135588, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 135589, 30, 5, {98,97,96,95,94}, {3,5,5,8,9} },
+  { 135599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 135666, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 135667, 20, 4, {98,97,96,95,0}, {3,5,6,6,0} },
+  { 135668, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 135669, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 135677, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 135678, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 135679, 30, 5, {98,97,96,95,94}, {3,5,6,7,9} },
+  { 135688, 30, 5, {98,97,96,95,94}, {3,5,6,8,8} },
+  { 135689, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 135699, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 135777, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 135778, 30, 5, {98,97,96,95,94}, {3,5,7,7,8} },
+  { 135779, 15, 3, {98,97,96,0,0}, {3,5,7,0,0} },
+  { 135788, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 135789, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 135799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 135888, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 135889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 135899, 25, 4, {98,97,96,95,0}, {3,5,8,9,0} },
+  { 135999, 35, 5, {98,97,96,95,94}, {3,5,9,9,9} },
+  { 136666, 15, 3, {98,97,96,0,0}, {3,6,6,0,0} },
+  { 136667, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 136668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 136669, 30, 5, {98,97,96,95,94}, {3,6,6,6,9} },
+  { 136677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 136678, 30, 5, {98,97,96,95,94}, {3,6,6,7,8} },
+  { 136679, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 136688, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 136689, 20, 3, {98,97,96,0,0}, {3,8,9,0,0} },
+  { 136699, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 136777, 30, 5, {98,97,96,95,94}, {3,6,7,7,7} },
+  { 136778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 136779, 25, 4, {98,97,96,95,0}, {3,6,7,9,0} },
+  { 136788, 25, 4, {98,97,96,95,0}, {3,6,8,8,0} },
+  { 136789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 136799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 136888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 136889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 136899, 35, 5, {98,97,96,95,94}, {3,6,8,9,9} },
+  { 136999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 137777, 10, 2, {98,97,0,0,0}, {3,7,0,0,0} },
+  { 137778, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 137779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 137788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 137789, 25, 4, {98,97,96,95,0}, {3,7,7,8,0} },
+  { 137799, 35, 5, {98,97,96,95,94}, {3,7,7,9,9} },
+  { 137888, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 137889, 35, 5, {98,97,96,95,94}, {3,7,8,8,9} },
+  { 137899, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 137999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 138888, 35, 5, {98,97,96,95,94}, {3,8,8,8,8} },
+  { 138889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 138899, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 138999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 139999, 30, 4, {98,97,96,95,0}, {3,9,9,9,0} },
+  { 144444, 20, 5, {98,97,96,95,94}, {4,4,4,4,4} },
+  { 144445, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 144446, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 144447, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 144448, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 144449, 25, 5, {98,97,96,95,94}, {4,4,4,4,9} },
+  { 144455, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 144456, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 144457, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 144458, 25, 5, {98,97,96,95,94}, {4,4,4,5,8} },
+  { 144459, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 144466, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 144467, 25, 5, {98,97,96,95,94}, {4,4,4,6,7} },
+  { 144468, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 144469, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 144477, 15, 3, {98,97,96,0,0}, {4,4,7,0,0} },
+  { 144478, 20, 4, {98,97,96,95,0}, {4,4,4,8,0} },
+  { 144479, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 144488, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 144489, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 144499, 30, 5, {98,97,96,95,94}, {4,4,4,9,9} },
+  { 144555, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 144556, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 144557, 25, 5, {98,97,96,95,94}, {4,4,5,5,7} },
+  { 144558, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 144559, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 144566, 25, 5, {98,97,96,95,94}, {4,4,5,6,6} },
+  { 144567, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 144568, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 144569, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 144577, 20, 4, {98,97,96,95,0}, {4,4,5,7,0} },
+  { 144578, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 144579, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 144588, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 144589, 30, 5, {98,97,96,95,94}, {4,4,5,8,9} },
+  { 144599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 144666, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 144667, 20, 4, {98,97,96,95,0}, {4,4,6,6,0} },
+  { 144668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 144669, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 144677, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 144678, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 144679, 30, 5, {98,97,96,95,94}, {4,4,6,7,9} },
+  { 144688, 30, 5, {98,97,96,95,94}, {4,4,6,8,8} },
+  { 144689, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 144699, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 144777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 144778, 30, 5, {98,97,96,95,94}, {4,4,7,7,8} },
+  { 144779, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 144788, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 144789, 25, 4, {98,97,96,95,0}, {4,4,8,9,0} },
+  { 144799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 144888, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 144889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 144899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 144999, 35, 5, {98,97,96,95,94}, {4,4,9,9,9} },
+  { 145555, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 145556, 25, 5, {98,97,96,95,94}, {4,5,5,5,6} },
+  { 145557, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 145558, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 145559, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 145566, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 145567, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 145568, 20, 4, {98,97,96,95,0}, {4,5,5,6,0} },
+  { 145569, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 145577, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 145578, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 145579, 30, 5, {98,97,96,95,94}, {4,5,5,7,9} },
+  { 145588, 30, 5, {98,97,96,95,94}, {4,5,5,8,8} },
+  { 145589, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 145599, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 145666, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 145667, 15, 3, {98,97,96,0,0}, {4,5,6,0,0} },
+  { 145668, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 145669, 30, 5, {98,97,96,95,94}, {4,5,6,6,9} },
+  { 145677, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 145678, 30, 5, {98,97,96,95,94}, {4,5,6,7,8} },
+  { 145679, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 145688, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 145689, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 145699, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 145777, 30, 5, {98,97,96,95,94}, {4,5,7,7,7} },
+  { 145778, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 145779, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 145788, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 145789, 25, 4, {98,97,96,95,0}, {4,5,7,9,0} },
+  { 145799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 145888, 25, 4, {98,97,96,95,0}, {4,5,8,8,0} },
+  { 145889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 145899, 35, 5, {98,97,96,95,94}, {4,5,8,9,9} },
+  { 145999, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 146666, 10, 2, {98,97,0,0,0}, {4,6,0,0,0} },
+  { 146667, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 146668, 30, 5, {98,97,96,95,94}, {4,6,6,6,8} },
+  { 146669, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 146677, 30, 5, {98,97,96,95,94}, {4,6,6,7,7} },
+  { 146678, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 146679, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 146688, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 146689, 25, 4, {98,97,96,95,0}, {4,6,6,9,0} },
+  { 146699, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 146777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 146778, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 146779, 20, 3, {98,97,96,0,0}, {4,7,9,0,0} },
+  { 146788, 25, 4, {98,97,96,95,0}, {4,6,7,8,0} },
+  { 146789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 146799, 35, 5, {98,97,96,95,94}, {4,6,7,9,9} },
+  { 146888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 146889, 35, 5, {98,97,96,95,94}, {4,6,8,8,9} },
+  { 146899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 146999, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 147777, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 147778, 25, 4, {98,97,96,95,0}, {4,7,7,7,0} },
+  { 147779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 147788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 147789, 35, 5, {98,97,96,95,94}, {4,7,7,8,9} },
+  { 147799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 147888, 35, 5, {98,97,96,95,94}, {4,7,8,8,8} },
+  { 147889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 147899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 147999, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 148888, 20, 3, {98,97,96,0,0}, {4,8,8,0,0} },
+  { 148889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 148899, 30, 4, {98,97,96,95,0}, {4,8,9,9,0} },
+  { 148999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 149999, 40, 5, {98,97,96,95,94}, {4,9,9,9,9} },
+  { 155555, 25, 5, {98,97,96,95,94}, {5,5,5,5,5} },
+  { 155556, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 155557, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 155558, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 155559, 20, 4, {98,97,96,95,0}, {5,5,5,5,0} },
+  { 155566, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155567, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155568, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155569, 30, 5, {98,97,96,95,94}, {5,5,5,6,9} },
+  { 155577, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155578, 30, 5, {98,97,96,95,94}, {5,5,5,7,8} },
+  { 155579, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155588, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155589, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155599, 15, 3, {98,97,96,0,0}, {5,5,5,0,0} },
+  { 155666, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155667, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155668, 30, 5, {98,97,96,95,94}, {5,5,6,6,8} },
+  { 155669, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 155677, 30, 5, {98,97,96,95,94}, {5,5,6,7,7} },
+  { 155678, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 155679, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 155688, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155689, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 155699, 25, 4, {98,97,96,95,0}, {5,5,6,9,0} },
+  { 155777, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155778, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 155779, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155788, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 155789, 25, 4, {98,97,96,95,0}, {5,5,7,8,0} },
+  { 155799, 35, 5, {98,97,96,95,94}, {5,5,7,9,9} },
+  { 155888, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155889, 35, 5, {98,97,96,95,94}, {5,5,8,8,9} },
+  { 155899, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 155999, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 156666, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 156667, 30, 5, {98,97,96,95,94}, {5,6,6,6,7} },
+  { 156668, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 156669, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 156677, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 156678, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 156679, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 156688, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 156689, 25, 4, {98,97,96,95,0}, {5,6,6,8,0} },
+  { 156699, 35, 5, {98,97,96,95,94}, {5,6,6,9,9} },
+  { 156777, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 156778, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 156779, 25, 4, {98,97,96,95,0}, {5,6,7,7,0} },
+  { 156788, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 156789, 35, 5, {98,97,96,95,94}, {5,6,7,8,9} },
+  { 156799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 156888, 35, 5, {98,97,96,95,94}, {5,6,8,8,8} },
+  { 156889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 156899, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 156999, 20, 3, {98,97,96,0,0}, {5,6,9,0,0} },
+  { 157777, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 157778, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 157779, 35, 5, {98,97,96,95,94}, {5,7,7,7,9} },
+  { 157788, 35, 5, {98,97,96,95,94}, {5,7,7,8,8} },
+  { 157789, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 157799, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 157888, 20, 3, {98,97,96,0,0}, {5,7,8,0,0} },
+  { 157889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 157899, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 157999, 30, 4, {98,97,96,95,0}, {5,7,9,9,0} },
+  { 158888, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 158889, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 158899, 30, 4, {98,97,96,95,0}, {5,8,8,9,0} },
+  { 158999, 40, 5, {98,97,96,95,94}, {5,8,9,9,9} },
+  { 159999, 10, 1, {98,0,0,0,0}, {5,0,0,0,0} },
+  { 166666, 30, 5, {98,97,96,95,94}, {6,6,6,6,6} },
+  { 166667, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 166668, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 166669, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 166677, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 166678, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 166679, 25, 4, {98,97,96,95,0}, {6,6,6,7,0} },
+  { 166688, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 166689, 35, 5, {98,97,96,95,94}, {6,6,6,8,9} },
+  { 166699, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 166777, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 166778, 20, 3, {98,97,96,0,0}, {6,6,8,0,0} },
+  { 166779, 35, 5, {98,97,96,95,94}, {6,6,7,7,9} },
+  { 166788, 35, 5, {98,97,96,95,94}, {6,6,7,8,8} },
+  { 166789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 166799, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 166888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 166889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 166899, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 166999, 30, 4, {98,97,96,95,0}, {6,6,9,9,0} },
+  { 167777, 20, 3, {98,97,96,0,0}, {6,7,7,0,0} },
+  { 167778, 35, 5, {98,97,96,95,94}, {6,7,7,7,8} },
+  { 167779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 167788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 167789, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 167799, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 167888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 167889, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 167899, 30, 4, {98,97,96,95,0}, {6,7,8,9,0} },
+  { 167999, 40, 5, {98,97,96,95,94}, {6,7,9,9,9} },
+  { 168888, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 168889, 30, 4, {98,97,96,95,0}, {6,8,8,8,0} },
+  { 168899, 40, 5, {98,97,96,95,94}, {6,8,8,9,9} },
+  { 168999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 169999, 15, 2, {98,97,0,0,0}, {6,9,0,0,0} },
+  { 177777, 35, 5, {98,97,96,95,94}, {7,7,7,7,7} },
+  { 177778, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 177779, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 177788, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 177789, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 177799, 30, 4, {98,97,96,95,0}, {7,7,7,9,0} },
+  { 177888, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 177889, 30, 4, {98,97,96,95,0}, {7,7,8,8,0} },
+  { 177899, 40, 5, {98,97,96,95,94}, {7,7,8,9,9} },
+  { 177999, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 178888, 15, 2, {98,97,0,0,0}, {7,8,0,0,0} },
+  { 178889, 40, 5, {98,97,96,95,94}, {7,8,8,8,9} },
+  { 178899, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 178999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 179999, 25, 3, {98,97,96,0,0}, {7,9,9,0,0} },
+  { 188888, 40, 5, {98,97,96,95,94}, {8,8,8,8,8} },
+  { 188889, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 188899, 25, 3, {98,97,96,0,0}, {8,8,9,0,0} },
+  { 188999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 189999, 35, 4, {98,97,96,95,0}, {8,9,9,9,0} },
+  { 199999, 45, 5, {98,97,96,95,94}, {9,9,9,9,9} },
+};
+
+extern const int s_numOpeningEntries = 2002;
+
+}
@@ -0,0 +1,249 @@
+#include <CQuintoPosition.h>
+
+namespace CQuinto {
+
+namespace {
+
+bool parseInt(const char *&p, int &i) {
+  if (*p < '0' || *p > '9')
+    return false;
+
+  i = 0;
+
+  while (*p >= '0' && *p <= '9') {
+    i = i*10 + (*p - '0');
+
+    if (i > 1000000)
+      return false;
+
+    ++p;
+  }
+
+  return true;
+}
+
+bool parseChar(const char *&p, char c) {
+  if (*p != c)
+    return false;
+
+  ++p;
+
+  return true;
+}
+
+void writeInt(std::string &str, int i) {
+  char buffer[16];
+
+  int n = 0;
+
+  do {
+    buffer[n++] = char('0' + i % 10);
+
+    i /= 10;
+  } while (i > 0);
+
+  while (n > 0)
+    str += buffer[--n];
+}
+
+}
+
+//---
+
+void
+Position::
+reset()
+{
+  for (int iy = 0; iy < NY; ++iy) {
+    for (int ix = 0; ix < NX; ++ix) {
+      values[iy][ix] = -1;
+      owners[iy][ix] = TileOwner::NONE;
+    }
+  }
+
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < HAND_SIZE; ++j)
+      hands[i][j] = -1;
+
+    scores[i] = 0;
+  }
+
+  player   = TileOwner::PLAYER1;
+  turn     = 0;
+  numTiles = 0;
+}
+
+bool
+Position::
+parse(const char *str)
+{
+  reset();
+
+  const char *p = str;
+
+  // board rows
+  for (int iy = 0; iy < NY; ++iy) {
+    if (iy > 0 && ! parseChar(p, '/'))
+      return false;
+
+    int ix = 0;
+
+    while (ix < NX) {
+      auto c = *p;
+
+      if      (c >= '0' && c <= '9') {
+        int n;
+
+        if (! parseInt(p, n) || n == 0 || ix + n > NX)
+          return false;
+
+        ix += n;
+      }
+      else if (c >= 'a' && c <= 'j') {
+        values[iy][ix] = int8_t(c - 'a');
+        owners[iy][ix] = TileOwner::PLAYER1;
+
+        ++ix; ++p;
+      }
+      else if (c >= 'A' && c <= 'J') {
+        values[iy][ix] = int8_t(c - 'A');
+        owners[iy][ix] = TileOwner::PLAYER2;
+
+        ++ix; ++p;
+      }
+      else
+        return false;
+    }
+  }
+
+  // hands
+  if (! parseChar(p, ' '))
+    return false;
+
+  for (int i = 0; i < 2; ++i) {
+    if (i > 0 && ! parseChar(p, '/'))
+      return false;
+
+    for (int j = 0; j < HAND_SIZE; ++j) {
+      auto c = *p++;
+
+      if      (c >= '0' && c <= '9')
+        hands[i][j] = int8_t(c - '0');
+      else if (c != '-')
+        return false;
+    }
+  }
+
+  // scores
+  if (! parseChar(p, ' ') || ! parseInt(p, scores[0]) ||
+      ! parseChar(p, '/') || ! parseInt(p, scores[1]))
+    return false;
+
+  // current player
+  if (! parseChar(p, ' '))
+    return false;
+
+  if      (parseChar(p, '1')) player = TileOwner::PLAYER1;
+  else if (parseChar(p, '2')) player = TileOwner::PLAYER2;
+  else                        return false;
+
+  // turn index (board stores turn stamps as 16 bit)
+  if (! parseChar(p, ' ') || ! parseInt(p, turn) || turn > MAX_TURNS)
+    return false;
+
+  // undrawn tiles
+  if (! parseChar(p, ' '))
+    return false;
+
+  if (! parseChar(p, '-')) {
+    while (*p >= '0' && *p <= '9') {
+      if (numTiles >= MAX_TILES)
+        return false;
+
+      tiles[numTiles++] = int8_t(*p++ - '0');
+    }
+
+    if (numTiles == 0)
+      return false;
+  }
+
+  // allow trailing line end
+  while (*p == '\r' || *p == '\n')
+    ++p;
+
+  return (*p == '\0');
+}
+
+void
+Position::
+write(std::string &str) const
+{
+  // board rows
+  for (int iy = 0; iy < NY; ++iy) {
+    if (iy > 0)
+      str += '/';
+
+    int n = 0;
+
+    for (int ix = 0; ix < NX; ++ix) {
+      auto value = values[iy][ix];
+
+      if (value < 0) {
+        ++n;
+        continue;
+      }
+
+      if (n > 0) {
+        writeInt(str, n);
+
+        n = 0;
+      }
+
+      str += char((owners[iy][ix] == TileOwner::PLAYER2 ? 'A' : 'a') + value);
+    }
+
+    if (n > 0)
+      writeInt(str, n);
+  }
+
+  // hands
+  str += ' ';
+
+  for (int i = 0; i < 2; ++i) {
+    if (i > 0)
+      str += '/';
+
+    for (int j = 0; j < HAND_SIZE; ++j)
+      str += (hands[i][j] >= 0 ? char('0' + hands[i][j]) : '-');
+  }
+
+  // scores, current player and turn index
+  str += ' '; writeInt(str, scores[0]);
+  str += '/'; writeInt(str, scores[1]);
+
+  str += (player == TileOwner::PLAYER2 ? " 2 " : " 1 ");
+
+  writeInt(str, turn);
+
+  // undrawn tiles
+  str += ' ';
+
+  if (numTiles == 0)
+    str += '-';
+
+  for (int i = 0; i < numTiles; ++i)
+    str += char('0' + tiles[i]);
+}
+
+std::string
+Position::
+toString() const
+{
+  std::string str;
+
+  write(str);
+
+  return str;
+}
+
+}
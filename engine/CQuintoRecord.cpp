@@ -0,0 +1,312 @@
+#include <CQuintoRecord.h>
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace CQuinto {
+
+namespace {
+
+const char     s_magic[4]       = { 'C', 'Q', 'G', 'R' };
+const uint16_t s_version        = 1;
+const int      FILE_HEADER_SIZE = 8;
+
+uint32_t getUInt(const uint8_t *p, int n) {
+  uint32_t i = 0;
+
+  for (int j = n - 1; j >= 0; --j)
+    i = (i << 8) | p[j];
+
+  return i;
+}
+
+void putUInt(uint8_t *p, uint64_t i, int n) {
+  for (int j = 0; j < n; ++j) {
+    p[j] = uint8_t(i & 0xff);
+
+    i >>= 8;
+  }
+}
+
+}
+
+//---
+
+Seed
+GameRecord::
+seed() const
+{
+  return (Seed(getUInt(data_ + 8, 4)) << 32) | getUInt(data_ + 4, 4);
+}
+
+int
+GameRecord::
+numTurns() const
+{
+  return int(getUInt(data_ + 14, 2));
+}
+
+int
+GameRecord::
+score(int player) const
+{
+  return int(getUInt(data_ + (player == 0 ? 16 : 18), 2));
+}
+
+//---
+
+void
+GameRecordBuilder::
+begin(Seed seed, int variant)
+{
+  data_.assign(GameRecord::HEADER_SIZE, 0);
+
+  putUInt(&data_[4], seed, 8);
+
+  data_[12] = uint8_t(variant);
+
+  numTurns_ = 0;
+}
+
+void
+GameRecordBuilder::
+addTurn(const Board &board)
+{
+  int n = board.numTurnCells();
+
+  data_.push_back(uint8_t(n));
+
+  for (int i = 0; i < n; ++i) {
+    const auto &pos = board.turnCell(i);
+
+    data_.push_back(uint8_t(BitBoard::cellInd(pos.ix, pos.iy)));
+    data_.push_back(uint8_t(board.cell(pos).value));
+  }
+
+  ++numTurns_;
+}
+
+void
+GameRecordBuilder::
+addPass()
+{
+  data_.push_back(0);
+
+  ++numTurns_;
+}
+
+void
+GameRecordBuilder::
+end(int score1, int score2)
+{
+  putUInt(&data_[ 0], data_.size(), 4);
+  putUInt(&data_[14], uint32_t(numTurns_), 2);
+  putUInt(&data_[16], uint32_t(score1   ), 2);
+  putUInt(&data_[18], uint32_t(score2   ), 2);
+}
+
+//---
+
+GameRecordWriter::
+~GameRecordWriter()
+{
+  close();
+}
+
+bool
+GameRecordWriter::
+open(const std::string &filename)
+{
+  close();
+
+  fp_ = fopen(filename.c_str(), "ab");
+
+  if (! fp_)
+    return false;
+
+  // new file : write header
+  if (fseek(fp_, 0, SEEK_END) == 0 && ftell(fp_) == 0) {
+    uint8_t header[FILE_HEADER_SIZE];
+
+    memcpy(header, s_magic, 4);
+
+    putUInt(&header[4], s_version, 2);
+    putUInt(&header[6], 0        , 2);
+
+    if (fwrite(header, FILE_HEADER_SIZE, 1, fp_) != 1) {
+      close();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void
+GameRecordWriter::
+close()
+{
+  if (fp_) {
+    fclose(fp_);
+
+    fp_ = nullptr;
+  }
+}
+
+bool
+GameRecordWriter::
+write(const GameRecord &record)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  if (! fp_)
+    return false;
+
+  return (fwrite(record.data(), record.size(), 1, fp_) == 1);
+}
+
+//---
+
+GameRecordReader::
+~GameRecordReader()
+{
+  close();
+}
+
+bool
+GameRecordReader::
+open(const std::string &filename)
+{
+  close();
+
+  int fd = ::open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+
+  if (fstat(fd, &st) != 0 || size_t(st.st_size) < size_t(FILE_HEADER_SIZE)) {
+    ::close(fd);
+    return false;
+  }
+
+  auto size = size_t(st.st_size);
+
+  void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  ::close(fd);
+
+  if (data == MAP_FAILED)
+    return false;
+
+  data_ = static_cast<const uint8_t *>(data);
+  size_ = size;
+
+  if (memcmp(data_, s_magic, 4) != 0 || getUInt(data_ + 4, 2) != s_version) {
+    close();
+    return false;
+  }
+
+  // validate records (up to first invalid record)
+  end_ = FILE_HEADER_SIZE;
+
+  while (end_ < size_) {
+    auto recordSize = validRecordSize(data_ + end_, size_ - end_);
+
+    if (recordSize == 0)
+      break;
+
+    end_ += recordSize;
+  }
+
+  rewind();
+
+  return true;
+}
+
+void
+GameRecordReader::
+close()
+{
+  if (data_) {
+    munmap(const_cast<uint8_t *>(data_), size_);
+
+    data_ = nullptr;
+    size_ = 0;
+    end_  = 0;
+    pos_  = 0;
+  }
+}
+
+void
+GameRecordReader::
+rewind()
+{
+  pos_ = FILE_HEADER_SIZE;
+}
+
+bool
+GameRecordReader::
+next(GameRecord &record)
+{
+  if (! data_ || pos_ >= end_)
+    return false;
+
+  const uint8_t *p = data_ + pos_;
+
+  uint32_t size = getUInt(p, 4);
+
+  record = GameRecord(p, size);
+
+  pos_ += size;
+
+  return true;
+}
+
+uint32_t
+GameRecordReader::
+validRecordSize(const uint8_t *data, size_t size)
+{
+  if (size < size_t(GameRecord::HEADER_SIZE))
+    return 0;
+
+  uint32_t recordSize = getUInt(data, 4);
+
+  if (recordSize < uint32_t(GameRecord::HEADER_SIZE) || recordSize > size)
+    return 0;
+
+  // check turns are inside record and placements are valid board cells and
+  // tile values (so visitTurns and placement users need no checks)
+  GameRecord record(data, recordSize);
+
+  size_t turnPos = GameRecord::HEADER_SIZE;
+
+  int numTurns = record.numTurns();
+
+  for (int i = 0; i < numTurns; ++i) {
+    if (turnPos >= recordSize || data[turnPos] > Board::MAX_TURN_CELLS)
+      return 0;
+
+    int numPlacements = data[turnPos++];
+
+    if (turnPos + 2*numPlacements > recordSize)
+      return 0;
+
+    for (int j = 0; j < numPlacements; ++j, turnPos += 2) {
+      if (data[turnPos] >= BitBoard::NC || data[turnPos + 1] > 9)
+        return 0;
+    }
+  }
+
+  if (turnPos != recordSize)
+    return 0;
+
+  return recordSize;
+}
+
+}
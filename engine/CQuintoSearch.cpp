@@ -0,0 +1,1360 @@
+#include <CQuintoSearch.h>
+#include <CQuintoOpening.h>
+#include <CQuintoThreadPool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace CQuinto {
+
+const Zobrist &
+Zobrist::
+instance()
+{
+  static Zobrist zobrist;
+
+  return zobrist;
+}
+
+Zobrist::
+Zobrist()
+{
+  // fixed seed splitmix64 sequence (independent of game seed)
+  uint64_t x = 0x5175696e746f3135ULL;
+
+  auto next = [&]() {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+  };
+
+  for (int i = 0; i < BitBoard::NC; ++i)
+    for (int v = 0; v < 10; ++v)
+      keys_[i][v] = next();
+}
+
+//------
+
+void
+SearchState::
+init(const Board &board, const Player &player, int turn)
+{
+  bits_ = board.bits();
+
+  numTurnCells_ = board.numTurnCells();
+
+  for (int i = 0; i < numTurnCells_; ++i)
+    turnCells_[i] = board.turnCell(i);
+
+  handSize_ = int(player.tiles().size());
+  assert(handSize_ <= MAX_HAND);
+
+  for (int i = 0; i < NUM_VALUES; ++i)
+    counts_[i] = 0;
+
+  valueMask_ = 0;
+  numTiles_  = 0;
+  slotMask_  = 0;
+
+  for (int i = 0; i < handSize_; ++i) {
+    hand_[i] = player.tile(i);
+
+    if (hand_[i] >= 0) {
+      auto value = hand_[i];
+
+      valueSlots_[value][counts_[value]++] = i;
+
+      valueMask_ |= uint16_t(1 << value);
+
+      slotMask_ |= (1U << i);
+
+      ++numTiles_;
+    }
+  }
+
+  owner_ = player.owner();
+  turn_  = turn;
+
+  numUndo_ = 0;
+  key_     = 0;
+
+  detailsValid_ = false;
+}
+
+void
+SearchState::
+make(int value, const TilePosition &pos)
+{
+  assert(counts_[value] > 0 && numTurnCells_ < MAX_CELLS);
+
+  auto &undo = undo_[numUndo_++];
+
+  undo.value = value;
+  undo.pos   = pos;
+
+  bits_.set(pos.ix, pos.iy, value, turn_, int(owner_));
+
+  turnCells_[numTurnCells_++] = pos;
+
+  if (--counts_[value] == 0)
+    valueMask_ &= uint16_t(~(1 << value));
+
+  slotMask_ &= ~(1U << valueSlots_[value][counts_[value]]);
+
+  --numTiles_;
+
+  key_ ^= Zobrist::instance().key(pos.ix, pos.iy, value);
+
+  detailsValid_ = false;
+}
+
+void
+SearchState::
+unmake()
+{
+  assert(numUndo_ > 0);
+
+  const auto &undo = undo_[--numUndo_];
+
+  bits_.reset(undo.pos.ix, undo.pos.iy);
+
+  --numTurnCells_;
+
+  slotMask_ |= (1U << valueSlots_[undo.value][counts_[undo.value]]);
+
+  if (counts_[undo.value]++ == 0)
+    valueMask_ |= uint16_t(1 << undo.value);
+
+  ++numTiles_;
+
+  key_ ^= Zobrist::instance().key(undo.pos.ix, undo.pos.iy, undo.value);
+
+  detailsValid_ = false;
+}
+
+void
+SearchState::
+commitTile(const TilePosition &pos, int value, int turn, TileOwner owner)
+{
+  assert(numUndo_ == 0);
+
+  bits_.set(pos.ix, pos.iy, value, turn, int(owner));
+
+  detailsValid_ = false;
+}
+
+const BoardDetails &
+SearchState::
+details() const
+{
+  if (! detailsValid_) {
+    Board::calcDetails(bits_, turnCells_, numTurnCells_, details_);
+
+    detailsValid_ = true;
+  }
+
+  return details_;
+}
+
+//------
+
+long
+PerftCounts::
+totalNodes() const
+{
+  long n = 0;
+
+  for (int i = 0; i <= maxDepth; ++i)
+    n += nodes[i];
+
+  return n;
+}
+
+long
+PerftCounts::
+totalTurns() const
+{
+  long n = 0;
+
+  for (int i = 0; i <= maxDepth; ++i)
+    n += turns[i];
+
+  return n;
+}
+
+void
+PerftCounts::
+print(std::ostream &os) const
+{
+  for (int i = 0; i <= maxDepth; ++i)
+    os << "depth=" << i << " nodes=" << nodes[i] << " turns=" << turns[i] << "\n";
+
+  os << "total nodes=" << totalNodes() << " turns=" << totalTurns() <<
+        " time=" << time*1000.0 << "ms nodes/s=" << long(nodesPerSec()) << "\n";
+}
+
+//------
+
+PlacementTable::
+PlacementTable()
+{
+  memset(keys_  , 0, sizeof(keys_  ));
+  memset(orders_, 0, sizeof(orders_));
+  memset(gens_  , 0, sizeof(gens_  ));
+}
+
+void
+PlacementTable::
+clear()
+{
+  // new generation (reset table on wrap)
+  if (++gen_ == 0) {
+    memset(gens_, 0, sizeof(gens_));
+
+    gen_ = 1;
+  }
+}
+
+bool
+PlacementTable::
+insert(Zobrist::Key key, uint64_t order)
+{
+  auto ind = uint32_t(key >> (64 - SIZE_BITS));
+
+  for (int i = 0; i < MAX_PROBE; ++i) {
+    auto j = (ind + i) & (SIZE - 1);
+
+    if (gens_[j] != gen_) {
+      keys_  [j] = key;
+      orders_[j] = order;
+      gens_  [j] = gen_;
+      return true;
+    }
+
+    if (keys_[j] == key) {
+      if (orders_[j] <= order)
+        return false;
+
+      // visited by later task (search again as earlier in serial order)
+      orders_[j] = order;
+
+      return true;
+    }
+  }
+
+  // table full for key (not stored so search repeats it)
+  return true;
+}
+
+//------
+
+void
+HandResidues::
+init(const SearchState &state)
+{
+  const int handSize = state.handSize();
+
+  // build from smaller sub hands (sub hand of mask is always smaller)
+  for (uint32_t mask = 0; mask < (1U << MAX_HAND); ++mask) {
+    for (int n1 = 0; n1 <= MAX_HAND; ++n1) {
+      for (int n2 = 0; n2 <= MAX_HAND; ++n2) {
+        if (n1 == 0 && n2 == 0) {
+          residues_[mask][n1][n2] = 1; // residue 0
+          continue;
+        }
+
+        uint8_t r = 0;
+
+        // place one tile of sub hand at weight 1 or weight 2 cell
+        for (int i = 0; i < handSize; ++i) {
+          if (! (mask & (1U << i)) || state.handTile(i) < 0)
+            continue;
+
+          auto value = state.handTile(i);
+          auto mask1 = mask & ~(1U << i);
+
+          if (n1 > 0) r |= rotate(residues_[mask1][n1 - 1][n2], value);
+          if (n2 > 0) r |= rotate(residues_[mask1][n1][n2 - 1], 2*value);
+        }
+
+        residues_[mask][n1][n2] = r;
+      }
+    }
+  }
+}
+
+//------
+
+SearchBudget::
+SearchBudget(double timeLimit, long nodeLimit) :
+ nodeLimit_(nodeLimit)
+{
+  if (timeLimit > 0.0) {
+    auto duration = std::chrono::duration<double>(timeLimit);
+
+    deadline_    = Clock::now() + std::chrono::duration_cast<Clock::duration>(duration);
+    hasDeadline_ = true;
+  }
+}
+
+bool
+SearchBudget::
+addNodes(int n)
+{
+  auto nodes = (nodes_ += n);
+
+  if (nodeLimit_ > 0 && nodes >= nodeLimit_)
+    stopped_ = true;
+
+  if (hasDeadline_ && Clock::now() >= deadline_)
+    stopped_ = true;
+
+  return ! isStopped();
+}
+
+//------
+
+Search::
+Search()
+{
+}
+
+Search::
+~Search()
+{
+}
+
+void
+Search::
+setNumThreads(int n)
+{
+  if (n <= 0)
+    n = std::max(int(std::thread::hardware_concurrency()), 1);
+
+  numThreads_ = n;
+}
+
+void
+Search::
+setSplitDepth(int depth)
+{
+  splitDepth_ = std::min(std::max(depth, 1), Board::MAX_TURN_CELLS);
+}
+
+void
+Search::
+init(const Board &board, const Player &player, int turn)
+{
+  state_.init(board, player, turn);
+
+  residues_.init(state_);
+}
+
+void
+Search::
+calcBestMove(BestMove &bestMove)
+{
+  stats_.reset();
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  if (openings_ && ! tree_ && lookupOpening(bestMove)) {
+    bestMove.proven = true;
+  }
+  else if (tree_) {
+    calcTreeBestMove(bestMove);
+
+    bestMove.proven = ! isCancelled();
+  }
+  else {
+    bestMove.reset();
+
+    // depth first search keeping best (max score, fewest tiles) complete move
+    bestMove_ = &bestMove;
+    found_    = false;
+
+    // budget (probe nodes are also charged)
+    bool budgeted = (timeLimit_ > 0.0 || nodeLimit_ > 0);
+
+    SearchBudget budget(timeLimit_, nodeLimit_);
+
+    budget_      = (budgeted ? &budget : nullptr);
+    budgetNodes_ = 0;
+
+    // quick ordered probe for initial best move and score bound
+    probeScore_ = -1;
+    probeBest_  = false;
+
+    if (bounded_) {
+      probeNodes_ = PROBE_NODES;
+
+      probeBestMove(0);
+    }
+
+    if (budgeted) {
+      // iterative deepening by max turn tiles (stops when no move skipped
+      // by limit or budget used)
+      for (maxTiles_ = 1; maxTiles_ <= Board::MAX_TURN_CELLS; ++maxTiles_) {
+        searchTiles();
+
+        if (! limited_ || budget.isStopped())
+          break;
+      }
+
+      bestMove.proven = ! budget.isStopped();
+
+      maxTiles_ = Board::MAX_TURN_CELLS;
+    }
+    else {
+      searchTiles();
+
+      bestMove.proven = true;
+    }
+
+    budget_ = nullptr;
+
+    if (isCancelled())
+      bestMove.proven = false;
+
+    bestMove_ = nullptr;
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+  stats_.time = elapsed.count();
+}
+
+// search best move with up to max tiles (keeps best move of earlier search)
+void
+Search::
+searchTiles()
+{
+  limited_ = false;
+
+  // placements are only skipped for same tiles limit
+  visited_.clear();
+
+  if (numThreads_ > 1)
+    calcParallelBestMove();
+  else
+    searchBestMove(0);
+}
+
+bool
+Search::
+hasMove()
+{
+  stats_.reset();
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  visited_.clear();
+
+  bool found = findMove(0);
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+  stats_.time = elapsed.count();
+
+  return found;
+}
+
+bool
+Search::
+findMove(int depth)
+{
+  assert(depth <= Board::MAX_TURN_CELLS);
+
+  if (isCancelled())
+    return false;
+
+  if (depth > 0 && ! visited_.insert(state_.key())) {
+    ++stats_.duplicates;
+    return false;
+  }
+
+  SearchMoves &moves = depthMoves_[depth];
+
+  moves.depth = depth;
+
+  if (! stateMoves(moves)) {
+    ++stats_.pruned;
+    return false;
+  }
+
+  stats_.addNode(depth);
+
+  stats_.pruned += moves.pruned;
+
+  // done if at least one tile placed and valid
+  if (depth > 0 && ! moves.partial)
+    return true;
+
+  if (moves.moves.empty()) {
+    ++stats_.leaves;
+    return false;
+  }
+
+  LineExtends extends;
+
+  if (lineExtends(extends) && ! canReachMultiple5(moves.score, extends)) {
+    ++stats_.pruned;
+    return false;
+  }
+
+  for (const auto &move : moves.moves) {
+    state_.make(move.value, move.pos);
+
+    bool found = findMove(depth + 1);
+
+    state_.unmake();
+
+    if (found)
+      return true;
+  }
+
+  return false;
+}
+
+void
+Search::
+calcTreeBestMove(BestMove &bestMove)
+{
+  bestMove.reset();
+
+  auto moveTree = this->moveTree();
+
+  if (! moveTree)
+    return;
+
+  //std::cerr << "Move Tree: "; moveTree->print(std::cerr); std::cerr << "\n";
+
+  auto maxLeaf = moveTree->maxLeaf();
+
+  if (maxLeaf) {
+    maxLeaf->hierMoves(bestMove.moves);
+
+    bestMove.score = maxLeaf->score;
+  }
+
+  //---
+
+  delete moveTree;
+}
+
+// best first turn from opening table, returns false if not first turn
+bool
+Search::
+lookupOpening(BestMove &bestMove)
+{
+  if (state_.bits().count() != 0 || state_.numTurnCells() != 0 ||
+      state_.numTiles() != OpeningTable::HAND_SIZE ||
+      state_.handSize() != OpeningTable::HAND_SIZE)
+    return false;
+
+  int values[OpeningTable::HAND_SIZE];
+
+  for (int i = 0; i < OpeningTable::HAND_SIZE; ++i)
+    values[i] = state_.handTile(i);
+
+  auto *entry = OpeningTable::find(OpeningTable::handKey(values, OpeningTable::HAND_SIZE));
+
+  if (! entry)
+    return false;
+
+  // map table placements to hand slots (same as search)
+  bestMove.reset();
+
+  int n = entry->numPlacements;
+
+  for (int i = 0; i < n; ++i) {
+    moves_[i].value = entry->values[i];
+    moves_[i].pos   = TilePosition(entry->cells[i] % BitBoard::NX, entry->cells[i] / BitBoard::NX);
+  }
+
+  slotMoves(n, bestMove.moves);
+
+  bestMove.score = entry->score;
+
+  return true;
+}
+
+void
+Search::
+searchBestMove(int depth)
+{
+  if (! searchNode(depth))
+    return;
+
+  const SearchMoves &moves = depthMoves_[depth];
+
+  for (const auto &move : moves.moves) {
+    moves_[depth] = move;
+
+    state_.make(move.value, move.pos);
+
+    searchBestMove(depth + 1);
+
+    state_.unmake();
+  }
+}
+
+// visit state : update best move and return if child moves need searching
+bool
+Search::
+searchNode(int depth)
+{
+  assert(depth <= Board::MAX_TURN_CELLS);
+
+  if (isCancelled() || ! checkBudget())
+    return false;
+
+  // skip if same placements already searched in different order
+  if (depth > 0 && ! visited_.insert(state_.key(), order_)) {
+    ++stats_.duplicates;
+    return false;
+  }
+
+  SearchMoves &moves = depthMoves_[depth];
+
+  moves.depth = depth;
+
+  if (! stateMoves(moves)) {
+    ++stats_.pruned;
+    return false;
+  }
+
+  stats_.addNode(depth);
+
+  stats_.pruned += moves.pruned;
+
+  if (moves.moves.empty())
+    ++stats_.leaves;
+
+  // update best if valid and not partial (non multiple of 5), first found
+  // is kept for equal score and depth (same as tree search) so a probe move
+  // (not in search order) is replaced by an equal move
+  if (! moves.partial) {
+    if (! found_ || moves.score > bestMove_->score ||
+        (moves.score == bestMove_->score &&
+         depth < int(bestMove_->moves.size()) + (probeBest_ ? 1 : 0))) {
+      slotMoves(depth, bestMove_->moves);
+
+      bestMove_->score = moves.score;
+
+      found_     = true;
+      probeBest_ = false;
+
+      if (sharedScore_)
+        updateSharedScore(moves.score);
+    }
+  }
+
+  if (moves.moves.empty())
+    return false;
+
+  // don't search moves past tiles limit (deeper search needed)
+  if (depth >= maxTiles_) {
+    limited_ = true;
+    return false;
+  }
+
+  // once line direction is fixed skip subtree if no extension of the line
+  // can make score a multiple of 5 or beat the best move so far
+  LineExtends extends;
+
+  if (lineExtends(extends)) {
+    if (! canReachMultiple5(moves.score, extends)) {
+      ++stats_.pruned;
+      return false;
+    }
+
+    if (bounded_ && ! canBeatBest(depth, upperBound(moves.score, extends))) {
+      ++stats_.bounded;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool
+Search::
+checkBudget()
+{
+  if (! budget_)
+    return true;
+
+  if (++budgetNodes_ >= SearchBudget::CHECK_NODES) {
+    auto n = budgetNodes_;
+
+    budgetNodes_ = 0;
+
+    return budget_->addNodes(n);
+  }
+
+  return ! budget_->isStopped();
+}
+
+void
+Search::
+calcParallelBestMove()
+{
+  // worker threads and search per thread
+  if (! pool_ || pool_->numThreads() != numThreads_)
+    pool_ = std::make_unique<ThreadPool>(numThreads_);
+
+  while (int(workers_.size()) < numThreads_)
+    workers_.push_back(std::make_unique<Search>());
+
+  // best score of all workers for bound (only used to skip strictly lower
+  // scores so result doesn't depend on order workers find moves)
+  std::atomic<int> sharedScore(found_ ? bestMove_->score : -1);
+
+  for (int i = 0; i < numThreads_; ++i)
+    workers_[i]->initWorker(this, &sharedScore);
+
+  auto numSteals = pool_->numSteals();
+
+  // root state task (adds child tasks down to split depth)
+  addTask(SearchTask());
+
+  pool_->wait();
+
+  stats_.steals = pool_->numSteals() - numSteals;
+
+  //---
+
+  // merge task results in serial search order (first found kept for equal
+  // score and depth)
+  TaskResults results;
+
+  for (int i = 0; i < numThreads_; ++i) {
+    auto *worker = workers_[i].get();
+
+    stats_.add(worker->stats_);
+
+    if (worker->limited_)
+      limited_ = true;
+
+    for (auto &result : worker->results_)
+      results.push_back(std::move(result));
+
+    worker->results_.clear();
+
+    worker->parent_      = nullptr;
+    worker->sharedScore_ = nullptr;
+  }
+
+  std::sort(results.begin(), results.end(),
+            [](const TaskResult &lhs, const TaskResult &rhs) {
+    return lhs.order < rhs.order;
+  });
+
+  for (const auto &result : results) {
+    const auto &bestMove = result.bestMove;
+
+    if (! found_ || bestMove.score > bestMove_->score ||
+        (bestMove.score == bestMove_->score &&
+         bestMove.moves.size() < bestMove_->moves.size() + (probeBest_ ? 1 : 0))) {
+      *bestMove_ = bestMove;
+
+      found_     = true;
+      probeBest_ = false;
+    }
+  }
+}
+
+void
+Search::
+initWorker(Search *search, std::atomic<int> *sharedScore)
+{
+  state_       = search->state_;
+  residues_    = search->residues_;
+  tree_        = false;
+  bounded_     = search->bounded_;
+  splitDepth_  = search->splitDepth_;
+  probeScore_  = search->probeScore_;
+  probeBest_   = false;
+  cancel_      = search->cancel_;
+  budget_      = search->budget_;
+  maxTiles_    = search->maxTiles_;
+  limited_     = false;
+  budgetNodes_ = 0;
+  parent_      = search;
+  sharedScore_ = sharedScore;
+
+  stats_.reset();
+
+  visited_.clear();
+
+  results_.clear();
+}
+
+void
+Search::
+addTask(const SearchTask &task)
+{
+  pool_->add([this, task](int thread) { workers_[thread]->runTask(task); });
+}
+
+void
+Search::
+runTask(const SearchTask &task)
+{
+  ++stats_.tasks;
+
+  // move from root state to task state
+  for (int i = 0; i < task.depth; ++i) {
+    moves_[i] = task.moves[i];
+
+    state_.make(moves_[i].value, moves_[i].pos);
+  }
+
+  order_ = task.order;
+
+  TaskResult result;
+
+  result.order = task.order;
+
+  bestMove_ = &result.bestMove;
+  found_    = false;
+
+  if (task.depth < splitDepth_) {
+    // search node and add task per child move (in reverse so first child
+    // is run first from back of deque)
+    if (searchNode(task.depth)) {
+      const auto &moves = depthMoves_[task.depth].moves;
+
+      int shift = ORDER_BITS*(Board::MAX_TURN_CELLS - 1 - task.depth);
+
+      assert(moves.size() < (1U << ORDER_BITS));
+
+      SearchTask child = task;
+
+      child.depth = task.depth + 1;
+
+      for (int i = int(moves.size()) - 1; i >= 0; --i) {
+        child.moves[task.depth] = moves[i];
+        child.order             = task.order + (uint64_t(i + 1) << shift);
+
+        parent_->addTask(child);
+      }
+    }
+  }
+  else
+    searchBestMove(task.depth);
+
+  if (found_)
+    results_.push_back(std::move(result));
+
+  bestMove_ = nullptr;
+
+  for (int i = 0; i < task.depth; ++i)
+    state_.unmake();
+}
+
+void
+Search::
+updateSharedScore(int score)
+{
+  int current = sharedScore_->load(std::memory_order_relaxed);
+
+  while (score > current &&
+         ! sharedScore_->compare_exchange_weak(current, score, std::memory_order_relaxed))
+    ;
+}
+MoveTree *
+Search::
+moveTree()
+{
+  auto root = new MoveTree;
+
+  (void) buildMoveTree(root, 0);
+
+  return root;
+}
+
+bool
+Search::
+buildMoveTree(MoveTree *tree, int depth)
+{
+  assert(depth <= Board::MAX_TURN_CELLS);
+
+  if (isCancelled())
+    return false;
+
+  // reuse move list for depth (keeps capacity so no allocation per node)
+  SearchMoves &moves = depthMoves_[depth];
+
+  moves.depth = depth;
+
+  if (! stateMoves(moves)) {
+    ++stats_.pruned;
+    return false;
+  }
+
+  stats_.addNode(depth);
+
+  stats_.pruned += moves.pruned;
+
+  if (moves.moves.empty())
+    ++stats_.leaves;
+
+  tree->partial = moves.partial;
+  tree->score   = moves.score;
+
+  for (const auto &move : moves.moves) {
+    moves_[depth] = move;
+
+    state_.make(move.value, move.pos);
+
+    auto child = new MoveTree;
+
+    if (buildMoveTree(child, depth + 1)) {
+      tree->addChild(child);
+
+      child->move = slotMove(depth);
+    }
+    else {
+      delete child;
+    }
+
+    state_.unmake();
+  }
+
+  return true;
+}
+
+void
+Search::
+perft(int maxDepth, PerftCounts &counts)
+{
+  counts.reset();
+
+  counts.maxDepth = std::min(std::max(maxDepth, 0), Board::MAX_TURN_CELLS);
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  // complete turns keyed by placement set hash (any order is same turn)
+  PerftKeys keys;
+
+  perftNode(0, counts.maxDepth, counts, keys);
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+  counts.time = elapsed.count();
+}
+
+void
+Search::
+perftNode(int depth, int maxDepth, PerftCounts &counts, PerftKeys &keys)
+{
+  SearchMoves &moves = depthMoves_[depth];
+
+  moves.depth = depth;
+
+  if (! stateMoves(moves))
+    return;
+
+  ++counts.nodes[depth];
+
+  if (depth > 0 && ! moves.partial && keys.insert(state_.key()).second)
+    ++counts.turns[depth];
+
+  if (depth >= maxDepth)
+    return;
+
+  for (const auto &move : moves.moves) {
+    state_.make(move.value, move.pos);
+
+    perftNode(depth + 1, maxDepth, counts, keys);
+
+    state_.unmake();
+  }
+}
+
+bool
+Search::
+stateMoves(SearchMoves &moves) const
+{
+  const auto &details = state_.details();
+
+  moves.moves.clear();
+
+  moves.pruned = 0;
+
+  if (! details.valid)
+    return false;
+
+  //assert(details.npt == moves.depth);
+
+  //---
+
+  moves.score   = details.score;
+  moves.partial = details.partial;
+
+  //---
+
+  // one move per distinct remaining hand value (in value order) which keeps
+  // lines through position legal (cross-checks)
+  const auto &bits = state_.bits();
+
+  auto valueMask = state_.valueMask();
+
+  for (const auto &position : details.validPositions) {
+    auto values = valueMask & bits.crossValues(position.ix, position.iy);
+
+    moves.pruned += __builtin_popcount(valueMask) - __builtin_popcount(values);
+
+    while (values) {
+      SearchMove move;
+
+      move.value = __builtin_ctz(values);
+      move.pos   = position;
+
+      values &= values - 1;
+
+      moves.moves.push_back(move);
+    }
+  }
+
+  return true;
+}
+
+void
+Search::
+slotMoves(int depth, Moves &moves) const
+{
+  moves.clear();
+
+  for (int i = 0; i < depth; ++i)
+    moves.push_back(slotMove(i));
+}
+
+void
+Search::
+commitMove(const Search &search, const BestMove &move)
+{
+  const auto &state = search.state();
+
+  for (const auto &m : move.moves) {
+    auto value = state.handTile(m.from().pos.ix);
+
+    state_.commitTile(m.to().pos, value, state.turn(), state.owner());
+  }
+}
+
+Move
+Search::
+slotMove(int depth) const
+{
+  // use first hand slot with move value not used by earlier moves
+  bool used[SearchState::MAX_HAND] = { false };
+
+  int slot = -1;
+
+  for (int i = 0; i <= depth; ++i) {
+    auto value = moves_[i].value;
+
+    slot = -1;
+
+    for (int j = 0; j < state_.handSize(); ++j) {
+      if (! used[j] && state_.handTile(j) == value) {
+        slot = j;
+        break;
+      }
+    }
+
+    assert(slot >= 0);
+
+    used[slot] = true;
+  }
+
+  TileData from(state_.owner(), TilePosition(slot, 0));
+  TileData to  (TileOwner::BOARD, moves_[depth].pos);
+
+  return Move(from, to);
+}
+
+void
+Search::
+probeBestMove(int depth)
+{
+  if (probeNodes_ <= 0)
+    return;
+
+  if (! checkBudget()) {
+    probeNodes_ = 0;
+    return;
+  }
+
+  --probeNodes_;
+
+  SearchMoves &moves = depthMoves_[depth];
+
+  moves.depth = depth;
+
+  if (! stateMoves(moves))
+    return;
+
+  // keep best complete probe move as initial best move
+  if (! moves.partial) {
+    if (! found_ || moves.score > bestMove_->score ||
+        (moves.score == bestMove_->score && depth < int(bestMove_->moves.size()))) {
+      slotMoves(depth, bestMove_->moves);
+
+      bestMove_->score = moves.score;
+
+      found_     = true;
+      probeBest_ = true;
+    }
+
+    probeScore_ = std::max(probeScore_, moves.score);
+  }
+
+  // try best looking moves first (highest value then longest line)
+  const auto &bits = state_.bits();
+
+  auto moveRank = [&](const SearchMove &move) {
+    auto ix = move.pos.ix, iy = move.pos.iy;
+
+    return 16*move.value + std::max(bits.hcross(ix, iy).len, bits.vcross(ix, iy).len);
+  };
+
+  std::sort(moves.moves.begin(), moves.moves.end(),
+            [&](const SearchMove &lhs, const SearchMove &rhs) {
+    return moveRank(lhs) > moveRank(rhs);
+  });
+
+  for (const auto &move : moves.moves) {
+    moves_[depth] = move;
+
+    state_.make(move.value, move.pos);
+
+    probeBestMove(depth + 1);
+
+    state_.unmake();
+
+    if (probeNodes_ <= 0)
+      break;
+  }
+}
+
+bool
+Search::
+canBeatBest(int depth, int maxScore) const
+{
+  // best score is at least probe score
+  if (maxScore < probeScore_)
+    return false;
+
+  // best score is at least best score found by any worker
+  if (sharedScore_ && maxScore < sharedScore_->load(std::memory_order_relaxed))
+    return false;
+
+  if (! found_)
+    return true;
+
+  if (maxScore < bestMove_->score)
+    return false;
+
+  // equal score must use fewer tiles (equal tiles found later loses, except
+  // to probe move)
+  int maxTiles = int(bestMove_->moves.size()) - (probeBest_ ? 0 : 1);
+
+  if (maxScore == bestMove_->score && depth + 1 > maxTiles)
+    return false;
+
+  return true;
+}
+
+bool
+Search::
+lineExtends(LineExtends &extends) const
+{
+  // only when line direction is fixed (two or more turn tiles)
+  auto numTurnCells = state_.numTurnCells();
+
+  if (numTurnCells < 2)
+    return false;
+
+  auto numTiles = state_.numTiles();
+
+  //---
+
+  const auto &bits = state_.bits();
+
+  const auto &pos1 = state_.turnCell(0);
+  const auto &pos2 = state_.turnCell(1);
+
+  bool horizontal = (pos1.iy == pos2.iy);
+
+  const auto &run = (horizontal ? bits.hrun(pos1.ix, pos1.iy) : bits.vrun(pos1.ix, pos1.iy));
+
+  // all turn tiles must be in single line (may not be for user placed tiles)
+  for (int i = 1; i < numTurnCells; ++i) {
+    const auto &pos = state_.turnCell(i);
+
+    if (horizontal) {
+      if (pos.iy != pos1.iy || pos.ix < run.start || pos.ix > run.end) return false;
+    }
+    else {
+      if (pos.ix != pos1.ix || pos.iy < run.start || pos.iy > run.end) return false;
+    }
+  }
+
+  //---
+
+  const int n = (horizontal ? BitBoard::NX : BitBoard::NY);
+
+  extends.lineLen = run.len();
+
+  auto extendLine = [&](int i, int dir, LineExtend *lineExtends) {
+    int ne  = 0;
+    int len = extends.lineLen;
+
+    while (ne < numTiles && i >= 0 && i < n && len < BitBoard::MAX_LINE) {
+      int ix = (horizontal ? i : pos1.ix);
+      int iy = (horizontal ? pos1.iy : i);
+
+      auto &extend = lineExtends[ne++];
+
+      // cached cross line of empty cell
+      const auto &cross = (horizontal ? bits.vcross(ix, iy) : bits.hcross(ix, iy));
+
+      extend.weight = (cross.len > 1 ? 2 : 1);
+      extend.sum    = cross.sum;
+      extend.len    = 1;
+
+      // join run beyond cell
+      auto j = i + dir;
+
+      int jx = (horizontal ? j : pos1.ix);
+      int jy = (horizontal ? pos1.iy : j);
+
+      if (j >= 0 && j < n && bits.isSet(jx, jy)) {
+        const auto &run1 = (horizontal ? bits.hrun(jx, jy) : bits.vrun(jx, jy));
+
+        extend.sum += run1.sum;
+        extend.len += run1.len();
+
+        i = (dir < 0 ? run1.start - 1 : run1.end + 1);
+      }
+      else
+        i = j;
+
+      len += extend.len;
+    }
+
+    return ne;
+  };
+
+  extends.nl = extendLine(run.start - 1, -1, extends.left );
+  extends.nr = extendLine(run.end   + 1,  1, extends.right);
+
+  return true;
+}
+
+template<typename FN>
+bool
+Search::
+visitExtends(const LineExtends &extends, FN fn) const
+{
+  // visit all combinations of left and right extensions (at least one tile
+  // and line no longer than max) with extension sum and weight counts
+  auto numTiles = state_.numTiles();
+
+  int lsum = 0, llen = 0, ln1 = 0, ln2 = 0;
+
+  for (int il = 0; il <= extends.nl; ++il) {
+    if (il > 0) {
+      const auto &e = extends.left[il - 1];
+
+      lsum += e.sum;
+      llen += e.len;
+
+      (e.weight == 1 ? ln1 : ln2)++;
+    }
+
+    int rsum = 0, rlen = 0, rn1 = 0, rn2 = 0;
+
+    for (int ir = 0; ir <= extends.nr; ++ir) {
+      if (ir > 0) {
+        const auto &e = extends.right[ir - 1];
+
+        rsum += e.sum;
+        rlen += e.len;
+
+        (e.weight == 1 ? rn1 : rn2)++;
+      }
+
+      auto nt = il + ir;
+
+      if (nt == 0 || nt > numTiles)
+        continue;
+
+      if (extends.lineLen + llen + rlen > BitBoard::MAX_LINE)
+        continue;
+
+      if (fn(lsum + rsum, ln1 + rn1, ln2 + rn2))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+bool
+Search::
+canReachMultiple5(int score, const LineExtends &extends) const
+{
+  auto slotMask = state_.slotMask();
+
+  return visitExtends(extends, [&](int sum, int n1, int n2) {
+    auto target = (5 - (score + sum) % 5) % 5;
+
+    return (residues_.residues(slotMask, n1, n2) & (1 << target)) != 0;
+  });
+}
+
+int
+Search::
+upperBound(int score, const LineExtends &extends) const
+{
+  // remaining hand values (largest first) and prefix sums
+  int values[SearchState::MAX_HAND];
+
+  int nv = 0;
+
+  for (int v = SearchState::NUM_VALUES - 1; v >= 0; --v)
+    for (int i = 0; i < state_.valueCount(v); ++i)
+      values[nv++] = v;
+
+  int sums[SearchState::MAX_HAND + 1];
+
+  sums[0] = 0;
+
+  for (int i = 0; i < nv; ++i)
+    sums[i + 1] = sums[i] + values[i];
+
+  // max score for extension is extension sum plus largest values on
+  // weight 2 cells and next largest on weight 1 cells
+  int maxScore = -1;
+
+  (void) visitExtends(extends, [&](int sum, int n1, int n2) {
+    auto extScore = score + sum + 2*sums[n2] + (sums[n1 + n2] - sums[n2]);
+
+    maxScore = std::max(maxScore, extScore);
+
+    return false;
+  });
+
+  return maxScore;
+}
+
+}
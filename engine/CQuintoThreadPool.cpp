@@ -0,0 +1,154 @@
+#include <CQuintoThreadPool.h>
+
+namespace CQuinto {
+
+namespace {
+
+// pool and deque index of current worker thread
+thread_local ThreadPool *s_threadPool  = nullptr;
+thread_local int         s_threadIndex = -1;
+
+}
+
+ThreadPool::
+ThreadPool(int numThreads)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+
+  for (int i = 0; i < numThreads; ++i)
+    queues_.push_back(std::make_unique<Queue>());
+
+  for (int i = 0; i < numThreads; ++i)
+    threads_.emplace_back([this, i]() { run(i); });
+}
+
+ThreadPool::
+~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    stop_ = true;
+  }
+
+  taskCond_.notify_all();
+
+  for (auto &thread : threads_)
+    thread.join();
+}
+
+void
+ThreadPool::
+add(const Task &task)
+{
+  int ind = (s_threadPool == this ? s_threadIndex : nextQueue_++ % numThreads());
+
+  ++numPending_;
+
+  {
+    auto &queue = *queues_[ind];
+
+    std::unique_lock<std::mutex> lock(queue.mutex);
+
+    queue.tasks.push_back(task);
+  }
+
+  ++numQueued_;
+
+  // wake sleeping thread (lock so wake can't be missed between check and wait)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+  }
+
+  taskCond_.notify_one();
+}
+
+void
+ThreadPool::
+wait()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  doneCond_.wait(lock, [this]() { return numPending_ == 0; });
+}
+
+void
+ThreadPool::
+run(int thread)
+{
+  s_threadPool  = this;
+  s_threadIndex = thread;
+
+  Task task;
+
+  while (true) {
+    if (popTask(thread, task)) {
+      task(thread);
+
+      task = Task();
+
+      if (--numPending_ == 0) {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        doneCond_.notify_all();
+      }
+
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    taskCond_.wait(lock, [this]() { return stop_ || numQueued_ > 0; });
+
+    if (stop_ && numQueued_ == 0)
+      break;
+  }
+}
+
+bool
+ThreadPool::
+popTask(int thread, Task &task)
+{
+  // newest task from own deque
+  {
+    auto &queue = *queues_[thread];
+
+    std::unique_lock<std::mutex> lock(queue.mutex);
+
+    if (! queue.tasks.empty()) {
+      task = std::move(queue.tasks.back());
+
+      queue.tasks.pop_back();
+
+      --numQueued_;
+
+      return true;
+    }
+  }
+
+  // oldest task from other deques
+  int n = numThreads();
+
+  for (int i = 1; i < n; ++i) {
+    auto &queue = *queues_[(thread + i) % n];
+
+    std::unique_lock<std::mutex> lock(queue.mutex);
+
+    if (! queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+
+      queue.tasks.pop_front();
+
+      --numQueued_;
+
+      ++numSteals_;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}
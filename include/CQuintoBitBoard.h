@@ -0,0 +1,418 @@
+#ifndef CQuintoBitBoard_H
+#define CQuintoBitBoard_H
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+namespace CQuinto {
+
+// 18x12 board as occupancy bit masks (row and column major copies), packed
+// 4 bit tile values, turn stamps and placing player per cell.
+//
+// Row mask bit ix is cell (ix, iy), column mask bit iy is cell (ix, iy) so
+// adjacency and run lengths are shifts and masks on a single word.
+//
+// Each set cell also stores the horizontal and vertical run (line of
+// consecutive tiles) it belongs to. These are updated by set/reset in
+// O(run length) so line extents and sums are table lookups.
+//
+// The anchor set (empty cells next to a tile where a tile can be played
+// without making a line longer than MAX_LINE) is also kept up to date by
+// set/reset, only the cells at the ends of the changed runs are rechecked.
+//
+// Each empty cell also caches the horizontal/vertical line a tile placed
+// there would make (length and sum mod 5 of the other tiles) and the cross
+// check masks derived from them: the tile values that keep the line legal
+// (at most MAX_LINE tiles and a multiple of 5 if MAX_LINE long). These are
+// updated with the anchors as the same cells (run ends) change.
+class BitBoard {
+ public:
+  using RowBits = uint32_t;
+  using ColBits = uint16_t;
+
+  // run of consecutive tiles (start/end index along row or column)
+  struct Run {
+    int8_t  start { 0 };
+    int8_t  end   { -1 };
+    int16_t sum   { 0 };
+
+    int len() const { return end - start + 1; }
+  };
+
+  // line through empty cell if a tile is placed there (length including
+  // new tile, sum and sum mod 5 of other tiles)
+  struct CrossLine {
+    int8_t  len  { 1 };
+    uint8_t sum  { 0 };
+    uint8_t sum5 { 0 };
+  };
+
+  static const int NX = 18;
+  static const int NY = 12;
+  static const int NC = NX*NY;
+
+  static const int MAX_LINE = 5;
+
+  static const uint16_t ALL_VALUES = 0x3ff; // tile values 0-9
+
+  static const RowBits ROW_MASK = (RowBits(1) << NX) - 1;
+  static const ColBits COL_MASK = (ColBits(1) << NY) - 1;
+
+ public:
+  BitBoard() { clear(); }
+
+  void clear() {
+    memset(rows_   , 0, sizeof(rows_   ));
+    memset(cols_   , 0, sizeof(cols_   ));
+    memset(values_ , 0, sizeof(values_ ));
+    memset(turns_  , 0, sizeof(turns_  ));
+    memset(players_, 0, sizeof(players_));
+    memset(anchors_, 0, sizeof(anchors_));
+
+    for (int i = 0; i < NC; ++i) {
+      hcross_ [i] = CrossLine();
+      vcross_ [i] = CrossLine();
+      hvalues_[i] = ALL_VALUES;
+      vvalues_[i] = ALL_VALUES;
+    }
+
+    numSet_ = 0;
+  }
+
+  static int cellInd(int ix, int iy) { return iy*NX + ix; }
+
+  //---
+
+  RowBits row(int iy) const { return rows_[iy]; }
+  ColBits col(int ix) const { return cols_[ix]; }
+
+  bool isSet(int ix, int iy) const { return (rows_[iy] >> ix) & 1; }
+
+  int value(int ix, int iy) const {
+    auto ind = cellInd(ix, iy);
+
+    return (values_[ind >> 1] >> ((ind & 1) << 2)) & 0xf;
+  }
+
+  int turn(int ix, int iy) const { return turns_[cellInd(ix, iy)]; }
+
+  int player(int ix, int iy) const { return players_[cellInd(ix, iy)]; }
+
+  int count() const { return numSet_; }
+
+  // same set cells with same tile values (turn and player ignored)
+  bool sameValues(const BitBoard &rhs) const {
+    if (numSet_ != rhs.numSet_)
+      return false;
+
+    for (int iy = 0; iy < NY; ++iy) {
+      if (rows_[iy] != rhs.rows_[iy])
+        return false;
+
+      for (auto bits = rows_[iy]; bits; bits &= bits - 1) {
+        auto ix = __builtin_ctz(bits);
+
+        if (value(ix, iy) != rhs.value(ix, iy))
+          return false;
+      }
+    }
+
+    return true;
+  }
+
+  // anchor cells (valid first placement of a turn) in row iy
+  RowBits anchorRow(int iy) const { return anchors_[iy]; }
+
+  bool isAnchor(int ix, int iy) const { return (anchors_[iy] >> ix) & 1; }
+
+  // horizontal/vertical line made by placing tile at empty cell (ix, iy)
+  const CrossLine &hcross(int ix, int iy) const { return hcross_[cellInd(ix, iy)]; }
+  const CrossLine &vcross(int ix, int iy) const { return vcross_[cellInd(ix, iy)]; }
+
+  // values which can be placed at empty cell (ix, iy) keeping the
+  // horizontal/vertical/both lines through it legal
+  uint16_t hvalues(int ix, int iy) const { return hvalues_[cellInd(ix, iy)]; }
+  uint16_t vvalues(int ix, int iy) const { return vvalues_[cellInd(ix, iy)]; }
+
+  uint16_t crossValues(int ix, int iy) const {
+    auto ind = cellInd(ix, iy);
+
+    return hvalues_[ind] & vvalues_[ind];
+  }
+
+  // horizontal/vertical run containing set cell (ix, iy)
+  const Run &hrun(int ix, int iy) const { return hruns_[cellInd(ix, iy)]; }
+  const Run &vrun(int ix, int iy) const { return vruns_[cellInd(ix, iy)]; }
+
+  //---
+
+  void set(int ix, int iy, int value, int turn, int player) {
+    assert(! isSet(ix, iy) && value >= 0 && value <= 9);
+
+    rows_[iy] |= RowBits(1) << ix;
+    cols_[ix] |= ColBits(1) << iy;
+
+    auto ind = cellInd(ix, iy);
+    auto sh  = (ind & 1) << 2;
+
+    values_ [ind >> 1] = uint8_t((values_[ind >> 1] & ~(0xf << sh)) | (value << sh));
+    turns_  [ind     ] = int16_t(turn);
+    players_[ind     ] = uint8_t(player);
+
+    ++numSet_;
+
+    //---
+
+    // join runs either side of new tile
+    Run hrun;
+
+    hrun.start = int8_t(ix - runLeft (ix, iy));
+    hrun.end   = int8_t(ix + runRight(ix, iy));
+    hrun.sum   = int16_t(value);
+
+    if (hrun.start < ix) hrun.sum += hruns_[cellInd(ix - 1, iy)].sum;
+    if (hrun.end   > ix) hrun.sum += hruns_[cellInd(ix + 1, iy)].sum;
+
+    setHRun(iy, hrun);
+
+    Run vrun;
+
+    vrun.start = int8_t(iy - runTop   (ix, iy));
+    vrun.end   = int8_t(iy + runBottom(ix, iy));
+    vrun.sum   = int16_t(value);
+
+    if (vrun.start < iy) vrun.sum += vruns_[cellInd(ix, iy - 1)].sum;
+    if (vrun.end   > iy) vrun.sum += vruns_[cellInd(ix, iy + 1)].sum;
+
+    setVRun(ix, vrun);
+
+    //---
+
+    anchors_[iy] &= ~(RowBits(1) << ix);
+
+    updateRunEnds(ix, iy, hrun, vrun);
+  }
+
+  void reset(int ix, int iy) {
+    assert(isSet(ix, iy));
+
+    auto hrun = hruns_[cellInd(ix, iy)];
+    auto vrun = vruns_[cellInd(ix, iy)];
+
+    rows_[iy] &= ~(RowBits(1) << ix);
+    cols_[ix] &= ~(ColBits(1) << iy);
+
+    --numSet_;
+
+    //---
+
+    // split runs either side of removed tile
+    if (hrun.start < ix) setHRun(iy, calcHRun(hrun.start, ix - 1, iy));
+    if (hrun.end   > ix) setHRun(iy, calcHRun(ix + 1, hrun.end, iy));
+
+    if (vrun.start < iy) setVRun(ix, calcVRun(vrun.start, iy - 1, ix));
+    if (vrun.end   > iy) setVRun(ix, calcVRun(iy + 1, vrun.end, ix));
+
+    //---
+
+    updateEmptyCell(ix, iy);
+
+    updateRunEnds(ix, iy, hrun, vrun);
+  }
+
+  //---
+
+  // number of consecutive set cells to left/right/top/bottom of (ix, iy)
+  // (not including the cell itself)
+  int runLeft(int ix, int iy) const {
+    if (ix == 0) return 0;
+
+    RowBits m = rows_[iy] << (32 - ix);
+
+    return __builtin_clz(~m);
+  }
+
+  int runRight(int ix, int iy) const {
+    RowBits m = rows_[iy] >> (ix + 1);
+
+    return __builtin_ctz(~m);
+  }
+
+  int runTop(int ix, int iy) const {
+    if (iy == 0) return 0;
+
+    RowBits m = RowBits(cols_[ix]) << (32 - iy);
+
+    return __builtin_clz(~m);
+  }
+
+  int runBottom(int ix, int iy) const {
+    RowBits m = RowBits(cols_[ix]) >> (iy + 1);
+
+    return __builtin_ctz(~m);
+  }
+
+  //---
+
+  // empty cells in row iy with at least one set neighbour
+  RowBits adjacentRow(int iy) const {
+    RowBits occ = rows_[iy];
+
+    RowBits adj = (occ << 1) | (occ >> 1);
+
+    if (iy > 0     ) adj |= rows_[iy - 1];
+    if (iy < NY - 1) adj |= rows_[iy + 1];
+
+    return adj & ~occ & ROW_MASK;
+  }
+
+  // empty cells in column ix with at least one set neighbour
+  ColBits adjacentCol(int ix) const {
+    ColBits occ = cols_[ix];
+
+    ColBits adj = ColBits((occ << 1) | (occ >> 1));
+
+    if (ix > 0     ) adj |= cols_[ix - 1];
+    if (ix < NX - 1) adj |= cols_[ix + 1];
+
+    return adj & ~occ & COL_MASK;
+  }
+
+  // empty cells in row iy at the end of a horizontal run
+  RowBits runEndsRow(int iy) const {
+    RowBits occ = rows_[iy];
+
+    return ((occ << 1) | (occ >> 1)) & ~occ & ROW_MASK;
+  }
+
+  // empty cells in column ix at the end of a vertical run
+  ColBits runEndsCol(int ix) const {
+    ColBits occ = cols_[ix];
+
+    return ColBits((occ << 1) | (occ >> 1)) & ~occ & COL_MASK;
+  }
+
+ private:
+  // recheck anchor state and cross-checks of empty cells at ends of runs
+  // through (ix, iy)
+  void updateRunEnds(int ix, int iy, const Run &hrun, const Run &vrun) {
+    if (hrun.start > 0     ) updateEmptyCell(hrun.start - 1, iy);
+    if (hrun.end   < NX - 1) updateEmptyCell(hrun.end   + 1, iy);
+    if (vrun.start > 0     ) updateEmptyCell(ix, vrun.start - 1);
+    if (vrun.end   < NY - 1) updateEmptyCell(ix, vrun.end   + 1);
+  }
+
+  void updateEmptyCell(int ix, int iy) {
+    if (isSet(ix, iy))
+      return;
+
+    RowBits bit = RowBits(1) << ix;
+
+    auto l = runLeft(ix, iy), r = runRight (ix, iy);
+    auto t = runTop (ix, iy), b = runBottom(ix, iy);
+
+    bool anchor = false;
+
+    if ((adjacentRow(iy) & bit) != 0)
+      anchor = (l + r + 1 <= MAX_LINE && t + b + 1 <= MAX_LINE);
+
+    if (anchor)
+      anchors_[iy] |= bit;
+    else
+      anchors_[iy] &= ~bit;
+
+    //---
+
+    int hsum = 0, vsum = 0;
+
+    if (l > 0) hsum += hruns_[cellInd(ix - 1, iy)].sum;
+    if (r > 0) hsum += hruns_[cellInd(ix + 1, iy)].sum;
+    if (t > 0) vsum += vruns_[cellInd(ix, iy - 1)].sum;
+    if (b > 0) vsum += vruns_[cellInd(ix, iy + 1)].sum;
+
+    auto ind = cellInd(ix, iy);
+
+    auto &hcross = hcross_[ind];
+    auto &vcross = vcross_[ind];
+
+    hcross.len  = int8_t (l + r + 1);
+    hcross.sum  = uint8_t(hsum);
+    hcross.sum5 = uint8_t(hsum % 5);
+
+    vcross.len  = int8_t (t + b + 1);
+    vcross.sum  = uint8_t(vsum);
+    vcross.sum5 = uint8_t(vsum % 5);
+
+    hvalues_[ind] = lineValues(hcross);
+    vvalues_[ind] = lineValues(vcross);
+  }
+
+  // values which make cross line legal : shorter lines can still be
+  // extended (turn score is checked for multiple of 5, not each line)
+  static uint16_t lineValues(const CrossLine &cross) {
+    if (cross.len > MAX_LINE)
+      return 0;
+
+    if (cross.len < MAX_LINE)
+      return ALL_VALUES;
+
+    // full line must be multiple of 5 : v and v + 5 for v = -sum mod 5
+    auto v = (5 - cross.sum5) % 5;
+
+    return uint16_t((1 << v) | (1 << (v + 5)));
+  }
+
+  Run calcHRun(int start, int end, int iy) const {
+    Run run;
+
+    run.start = int8_t(start);
+    run.end   = int8_t(end);
+
+    for (int ix = start; ix <= end; ++ix)
+      run.sum += value(ix, iy);
+
+    return run;
+  }
+
+  Run calcVRun(int start, int end, int ix) const {
+    Run run;
+
+    run.start = int8_t(start);
+    run.end   = int8_t(end);
+
+    for (int iy = start; iy <= end; ++iy)
+      run.sum += value(ix, iy);
+
+    return run;
+  }
+
+  void setHRun(int iy, const Run &run) {
+    for (int ix = run.start; ix <= run.end; ++ix)
+      hruns_[cellInd(ix, iy)] = run;
+  }
+
+  void setVRun(int ix, const Run &run) {
+    for (int iy = run.start; iy <= run.end; ++iy)
+      vruns_[cellInd(ix, iy)] = run;
+  }
+
+ private:
+  RowBits   rows_   [NY];    // row major occupancy
+  ColBits   cols_   [NX];    // column major occupancy
+  uint8_t   values_ [NC/2];  // packed 4 bit values
+  int16_t   turns_  [NC];    // turn stamp
+  uint8_t   players_[NC];    // placing player (TileOwner)
+  Run       hruns_  [NC];    // horizontal run of each set cell
+  Run       vruns_  [NC];    // vertical run of each set cell
+  RowBits   anchors_[NY];    // anchor cells
+  CrossLine hcross_ [NC];    // horizontal line of empty cell
+  CrossLine vcross_ [NC];    // vertical line of empty cell
+  uint16_t  hvalues_[NC];    // horizontal cross-check values of empty cell
+  uint16_t  vvalues_[NC];    // vertical cross-check values of empty cell
+  int       numSet_ { 0 };   // number of set cells
+};
+
+}
+
+#endif
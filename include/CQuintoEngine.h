@@ -0,0 +1,807 @@
+#ifndef CQuintoEngine_H
+#define CQuintoEngine_H
+
+#include <CQuintoBitBoard.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+// Quinto rules and search engine (no Qt dependency)
+namespace CQuinto {
+
+class Game;
+class TileSet;
+class Player;
+class Turn;
+class Board;
+class Move;
+class Search;
+
+struct Position;
+
+//------
+
+enum class Direction {
+  NONE,
+  HORIZONTAL,
+  VERTICAL
+};
+
+enum class Side {
+  NONE,
+  LEFT,
+  RIGHT,
+  TOP,
+  BOTTOM
+};
+
+enum class TileOwner {
+  NONE,
+  PLAYER1,
+  PLAYER2,
+  BOARD,
+  TILE_SET
+};
+
+enum class PlayerType {
+  NONE,
+  HUMAN,
+  COMPUTER
+};
+
+// move/line error (converted to text with errorText only when displayed)
+enum class ErrorCode {
+  NONE,
+  LINE_TOO_LONG,
+  NOT_MULTIPLE_5,
+  NOT_MULTIPLE_5_YET,
+  DISJOINT_PIECES
+};
+
+const char *errorText(ErrorCode error);
+
+//----
+
+// player hand (tile values, -1 for empty slot) and score
+class Player {
+ public:
+  using Tiles = std::vector<int>;
+
+ public:
+  Player(Game *game, TileOwner owner, const std::string &name, PlayerType type);
+
+  TileOwner owner() const { return owner_; }
+
+  PlayerType type() const { return type_; }
+  void setType(PlayerType type) { type_ = type; }
+
+  const std::string &name() const { return name_; }
+  void setName(const std::string &s) { name_ = s; }
+
+  const Tiles &tiles() const { return tiles_; }
+
+  int numTiles() const;
+
+  bool hasTile(int i) const { return tiles_[i] >= 0; }
+
+  int tile(int i) const;
+
+  int takeTile(int i, bool nocheck=false);
+
+  void addTile(int value, int i);
+
+  int score() const { return score_; }
+  void setScore(int i) { score_ = i; }
+
+  bool canMove() const { return canMove_; }
+  void setCanMove(bool b) { canMove_ = b; }
+
+  void addScore(int i) { score_ += i; }
+
+  void drawTiles();
+
+ private:
+  Game*       game_    { nullptr };
+  TileOwner   owner_   { TileOwner::NONE };
+  std::string name_;
+  PlayerType  type_    { PlayerType::NONE };
+  Tiles       tiles_;
+  int         score_   { 0 };
+  bool        canMove_ { true };
+};
+
+using PlayerP = std::unique_ptr<Player>;
+
+//------
+
+// tile set shuffle seed (same seed gives same game tile order)
+using Seed = uint64_t;
+
+// small per instance random number generator (splitmix64) giving the same
+// sequence for a seed on every platform (unlike rand() or std distributions)
+class Random {
+ public:
+  Random(Seed seed=0) :
+   state_(seed) {
+  }
+
+  void setSeed(Seed seed) { state_ = seed; }
+
+  uint64_t next();
+
+  // uniform random integer in range [0, n)
+  int range(int n);
+
+  // non-repeatable seed (for new interactive games)
+  static Seed randomSeed();
+
+ private:
+  uint64_t state_ { 0 };
+};
+
+//------
+
+// bag of undrawn tile values (drawn from back)
+class TileSet {
+ public:
+  TileSet(Seed seed=0);
+
+  int numTiles() const { return tiles_.size(); }
+
+  Seed seed() const { return seed_; }
+
+  // undrawn tile (drawn from end)
+  int tile(int i) const { return tiles_[i]; }
+
+  void clear() { tiles_.clear(); }
+
+  // shuffle tiles (sorted first so order only depends on tiles and seed)
+  void shuffle(Seed seed);
+
+  int getTile();
+
+  void ungetTile(int value);
+
+ private:
+  using Tiles = std::vector<int>;
+
+  Tiles  tiles_;
+  Seed   seed_ { 0 }; // shuffle seed
+  Random random_;     // shuffle random numbers
+};
+
+using TileSetP = std::unique_ptr<TileSet>;
+
+//------
+
+struct TilePosition {
+  int ix { -1 };
+  int iy { -1 };
+
+  TilePosition() = default;
+
+  TilePosition(int ix, int iy) :
+   ix(ix), iy(iy) {
+  }
+
+  bool isValid() const { return (ix >= 0 && iy >= 0); }
+
+  TilePosition left  () const { return TilePosition(ix - 1, iy    ); }
+  TilePosition right () const { return TilePosition(ix + 1, iy    ); }
+  TilePosition top   () const { return TilePosition(ix    , iy - 1); }
+  TilePosition bottom() const { return TilePosition(ix    , iy + 1); }
+
+  bool operator==(const TilePosition &rhs) const {
+    return (ix == rhs.ix && iy == rhs.iy);
+  }
+
+  bool operator<(const TilePosition &rhs) const {
+    return (ix < rhs.ix || (ix == rhs.ix && iy < rhs.iy));
+  }
+};
+
+// set of board positions stored as column bit masks (no allocation),
+// iterates in TilePosition (column then row) order
+class TilePositions {
+ public:
+  class const_iterator {
+   public:
+    const_iterator(const TilePositions *positions, int ix) :
+     positions_(positions), ix_(ix) {
+      bits_ = (ix_ < BitBoard::NX ? positions_->cols_[ix_] : 0);
+
+      skipEmpty();
+    }
+
+    TilePosition operator*() const { return TilePosition(ix_, __builtin_ctz(bits_)); }
+
+    const_iterator &operator++() {
+      bits_ &= bits_ - 1;
+
+      skipEmpty();
+
+      return *this;
+    }
+
+    bool operator==(const const_iterator &rhs) const {
+      return (ix_ == rhs.ix_ && bits_ == rhs.bits_);
+    }
+
+    bool operator!=(const const_iterator &rhs) const { return ! (*this == rhs); }
+
+   private:
+    void skipEmpty() {
+      while (! bits_ && ix_ < BitBoard::NX) {
+        ++ix_;
+
+        bits_ = (ix_ < BitBoard::NX ? positions_->cols_[ix_] : 0);
+      }
+    }
+
+   private:
+    const TilePositions* positions_ { nullptr };
+    int                  ix_        { 0 };
+    BitBoard::ColBits    bits_      { 0 };
+  };
+
+ public:
+  TilePositions() { clear(); }
+
+  void clear() {
+    for (int ix = 0; ix < BitBoard::NX; ++ix)
+      cols_[ix] = 0;
+  }
+
+  bool empty() const {
+    for (int ix = 0; ix < BitBoard::NX; ++ix)
+      if (cols_[ix]) return false;
+
+    return true;
+  }
+
+  int size() const {
+    int n = 0;
+
+    for (int ix = 0; ix < BitBoard::NX; ++ix)
+      n += __builtin_popcount(cols_[ix]);
+
+    return n;
+  }
+
+  bool contains(const TilePosition &pos) const { return (cols_[pos.ix] >> pos.iy) & 1; }
+
+  void insert(const TilePosition &pos) { cols_[pos.ix] |= BitBoard::ColBits(1 << pos.iy); }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end  () const { return const_iterator(this, BitBoard::NX); }
+
+ private:
+  BitBoard::ColBits cols_[BitBoard::NX];
+};
+
+struct TileData {
+  TileOwner    owner { TileOwner::NONE };
+  TilePosition pos;
+
+  TileData() = default;
+
+  TileData(TileOwner owner, const TilePosition &pos);
+
+  void print(std::ostream &os) const;
+};
+
+struct ValidScore {
+  bool valid { false };
+  int  score { 0 };
+};
+
+// board cell contents (tile value, placing player and turn)
+struct Cell {
+  int       value  { -1 };
+  TileOwner player { TileOwner::NONE };
+  int       turn   { -1 };
+
+  Cell() = default;
+
+  Cell(int value, TileOwner player, int turn) :
+   value(value), player(player), turn(turn) {
+  }
+
+  bool isSet() const { return value >= 0; }
+};
+
+//---
+
+class Move {
+ public:
+  Move() = default;
+
+  Move(const TileData &from, const TileData &to) :
+   from_(from), to_(to) {
+  }
+
+  const TileData &from() const { return from_; }
+  const TileData &to  () const { return to_  ; }
+
+  bool isValid() const {
+    return (from_.owner != TileOwner::NONE && to_.owner != TileOwner::NONE);
+  }
+
+  void print(std::ostream &os) const {
+    os << "From: "; from_.print(os); os << " To: "; to_.print(os);
+  }
+
+ private:
+  TileData from_;
+  TileData to_;
+};
+
+//---
+
+struct LineValid {
+  bool      partial { false };
+  ErrorCode error   { ErrorCode::NONE };
+};
+
+//---
+
+struct TileLine {
+  Direction direction { Direction::NONE };
+  int       start     { -1 };
+  int       end       { -1 };
+  int       pos       { -1 };
+  int       sum       { 0 };
+  int       current   { 0 };
+
+  TileLine() = default;
+
+  TileLine(Direction direction, int start, int end, int pos);
+
+  int len() const;
+
+  bool hasPosition(const TilePosition &p) const;
+
+  TilePosition startPos() const;
+
+  bool isValid(LineValid &lineValid) const;
+
+  void print(std::ostream &os) const;
+
+  void print(std::ostream &os, ErrorCode error) const;
+};
+
+// fixed capacity line list (at most one line per current turn tile)
+class TileLines {
+ public:
+  static const int MAX_LINES = 5;
+
+  using iterator       = TileLine *;
+  using const_iterator = const TileLine *;
+
+ public:
+  TileLines() = default;
+
+  bool empty() const { return n_ == 0; }
+
+  int size() const { return n_; }
+
+  void clear() { n_ = 0; }
+
+  void push_back(const TileLine &line) { assert(n_ < MAX_LINES); lines_[n_++] = line; }
+
+  iterator begin() { return &lines_[0]; }
+  iterator end  () { return &lines_[n_]; }
+
+  const_iterator begin() const { return &lines_[0]; }
+  const_iterator end  () const { return &lines_[n_]; }
+
+ private:
+  TileLine lines_[MAX_LINES];
+  int      n_ { 0 };
+};
+
+//---
+
+struct BoardDetails {
+  bool          valid   { false };
+  bool          partial { false };
+  int           score   { 0 };
+  int           nt      { 0 };
+  int           npt     { 0 };
+  TilePositions validPositions;
+  ErrorCode     error   { ErrorCode::NONE };
+
+  void reset();
+
+  void addValidPosition(const TilePosition &pos);
+};
+
+struct BestMove {
+  using Moves = std::vector<Move>;
+
+  Moves moves;
+  int   score  { 0 };
+  bool  proven { false }; // search completed (no better move)
+
+  bool isValid() const { return ! moves.empty(); }
+
+  void reset() { moves.clear(); score = 0; proven = false; }
+};
+
+// best move search statistics (for last search)
+struct SearchStats {
+  int    nodes      { 0 };   // nodes visited
+  int    leaves     { 0 };   // nodes with no child moves
+  int    maxDepth   { 0 };   // max depth (number of tiles) searched
+  int    pruned     { 0 };   // branches pruned (invalid moves)
+  int    duplicates { 0 };   // placement permutations skipped
+  int    bounded    { 0 };   // subtrees skipped by score bound
+  int    tasks      { 0 };   // parallel search tasks
+  int    steals     { 0 };   // parallel search tasks stolen by idle threads
+  double time       { 0.0 }; // wall time (seconds)
+
+  void reset() { *this = SearchStats(); }
+
+  // add counts of other (worker) search
+  void add(const SearchStats &stats) {
+    nodes      += stats.nodes;
+    leaves     += stats.leaves;
+    pruned     += stats.pruned;
+    duplicates += stats.duplicates;
+    bounded    += stats.bounded;
+    tasks      += stats.tasks;
+    steals     += stats.steals;
+
+    if (stats.maxDepth > maxDepth)
+      maxDepth = stats.maxDepth;
+  }
+
+  double nodesPerSec() const { return (time > 0.0 ? nodes/time : 0.0); }
+
+  void addNode(int depth) {
+    ++nodes;
+
+    if (depth > maxDepth)
+      maxDepth = depth;
+  }
+
+  void print(std::ostream &os) const;
+};
+
+//---
+
+struct MoveTree {
+  using Children  = std::vector<MoveTree *>;
+  using MoveTrees = std::vector<const MoveTree *>;
+  using ScoreTree = std::map<int,MoveTrees>;
+  using Moves     = std::vector<Move>;
+
+  MoveTree*         parent  { nullptr };
+  Move              move;
+  Children          children;
+  bool              partial { false };
+  int               score   { 0 };
+  mutable ScoreTree scoreTree;
+
+  MoveTree();
+
+ ~MoveTree();
+
+  void addChild(MoveTree *child) {
+    child->parent = this;
+
+    children.push_back(child);
+  }
+
+  MoveTree *root() { if (! parent) return this; return parent->root(); }
+
+  const MoveTree *maxLeaf() const;
+
+  void updateScoreTree(ScoreTree &scoreTree) const;
+
+  int depth() const;
+
+  int size() const;
+
+  void hierMoves(Moves &move) const;
+
+  void printDepth(std::ostream &os, int depth) const;
+
+  void print(std::ostream &os) const;
+};
+
+//---
+
+struct BoardLines {
+  BitBoard::RowBits xinds { 0 }; // columns containing current tiles
+  BitBoard::ColBits yinds { 0 }; // rows containing current tiles
+  TileLines         hlines;
+  TileLines         vlines;
+
+  int numX() const { return __builtin_popcount(xinds); }
+  int numY() const { return __builtin_popcount(yinds); }
+
+  int score() const;
+};
+
+//---
+
+// board cells, move legality (details) and best move search
+class Board {
+ public:
+  using Moves     = std::vector<Move>;
+  using MovesList = std::vector<Moves>;
+
+  static const int MAX_TURN_CELLS = 5;
+  static const int MAX_DEPTH      = MAX_TURN_CELLS + 1;
+
+ public:
+  Board(Game *game);
+ ~Board();
+
+  bool validPos(const TilePosition &pos) const;
+
+  const BitBoard &bits() const { return bits_; }
+
+  Cell cell(const TilePosition &pos) const {
+    if (! hasCell(pos))
+      return Cell();
+
+    return Cell(bits_.value (pos.ix, pos.iy), TileOwner(bits_.player(pos.ix, pos.iy)),
+                bits_.turn  (pos.ix, pos.iy));
+  }
+
+  bool hasCell(const TilePosition &pos) const { return bits_.isSet(pos.ix, pos.iy); }
+
+  Cell takeCell(const TilePosition &pos);
+
+  void setCell(const TilePosition &pos, const Cell &cell);
+
+  // start new turn (no tiles placed for current turn)
+  void startTurn();
+
+  int numTurnCells() const { return numTurnCells_; }
+
+  const TilePosition &turnCell(int i) const { return turnCells_[i]; }
+
+  //---
+
+  bool playBestMove();
+  void showBestMove() const;
+
+  void invalidateBestMove() { bestMoveValid_ = false; }
+
+  const BestMove &getBestMove() const;
+
+  // set best move (and stats) from search of current board and player in
+  // other (background) search, see initSearch
+  void setBestMove(const BestMove &bestMove, const SearchStats &stats);
+
+  // check if current player has any complete move (uses best move if
+  // already calculated, otherwise stops at first move found)
+  bool hasMove() const;
+
+  // build full move tree for best move search (debug/analysis) instead of
+  // streaming depth first search
+  bool isSearchTree() const { return searchTree_; }
+  void setSearchTree(bool b) { searchTree_ = b; invalidateBestMove(); }
+
+  // skip search subtrees which can't beat best move
+  bool isSearchBounded() const { return searchBounded_; }
+  void setSearchBounded(bool b) { searchBounded_ = b; invalidateBestMove(); }
+
+  // number of threads for best move search (1 for serial search, 0 for
+  // hardware thread count). Best move is the same for any thread count.
+  int searchThreads() const { return searchThreads_; }
+  void setSearchThreads(int n) { searchThreads_ = n; }
+
+  // depth of subtree tasks for parallel search (1 for root moves, nodes
+  // above depth are split into a task per child move)
+  int searchSplitDepth() const { return searchSplitDepth_; }
+  void setSearchSplitDepth(int depth) { searchSplitDepth_ = depth; }
+
+  // per move search budget (time in seconds and nodes, 0 for no limit).
+  // Search with budget returns best move found when budget is used (not
+  // proven best)
+  double searchTimeLimit() const { return searchTimeLimit_; }
+  void setSearchTimeLimit(double t) { searchTimeLimit_ = t; invalidateBestMove(); }
+
+  long searchNodeLimit() const { return searchNodeLimit_; }
+  void setSearchNodeLimit(long n) { searchNodeLimit_ = n; invalidateBestMove(); }
+
+  // stats of last search
+  const SearchStats &searchStats() const { return searchStats_; }
+
+  // stats of last has move search (not a best move search)
+  const SearchStats &hasMoveStats() const { return hasMoveStats_; }
+
+  // print search stats after each search
+  bool isPrintStats() const { return printStats_; }
+  void setPrintStats(bool b) { printStats_ = b; }
+
+  MoveTree *boardMoveTree() const;
+
+  // copy current board and player hand (and search settings) to search
+  void initSearch(Search &search) const;
+
+  // copy current board and player hand for turn to search
+  void initSearch(Search &search, const Player &player, int turn) const;
+
+  //---
+
+  void invalidateDetails() { detailsValid_ = false; }
+
+  const BoardDetails &boardDetails() const;
+
+  void getBoardLines(BoardLines &lines) const;
+
+  // calc details/lines for cells and current turn cells
+  static void calcDetails(const BitBoard &bits, const TilePosition *turnCells,
+                          int numTurnCells, BoardDetails &details);
+
+  static void getLines(const BitBoard &bits, const TilePosition *turnCells,
+                       int numTurnCells, BoardLines &lines);
+
+ private:
+  void calcBestMove();
+
+  void calcBoardDetails();
+
+  void updateSearchStats(const char *name, const SearchStats &stats);
+
+  void printSearchStats(const char *name, const SearchStats &stats) const;
+
+ private:
+  Game*        game_             { nullptr }; // parent game
+  BitBoard     bits_;                         // cell bit board
+  TilePosition turnCells_[MAX_TURN_CELLS];    // cells placed in current turn
+  int          numTurnCells_     { 0 };       // number of current turn cells
+  BoardDetails details_;                      // board details
+  bool         detailsValid_     { false };   // are board details current
+  BestMove     bestMove_;                     // best move
+  bool         bestMoveValid_    { false };   // is best move current
+  bool         searchTree_       { false };   // build move tree for search
+  bool         searchBounded_    { true };    // bounded search
+  int          searchThreads_    { 1 };       // search threads
+  int          searchSplitDepth_ { 2 };       // parallel search split depth
+  double       searchTimeLimit_  { 0.0 };     // search time limit (seconds)
+  long         searchNodeLimit_  { 0 };       // search node limit
+  bool         printStats_       { false };   // print search stats
+  SearchStats  searchStats_;                  // last search stats
+
+  mutable SearchStats hasMoveStats_;          // last has move search stats
+
+  std::unique_ptr<Search> search_;            // best move search
+};
+
+using BoardP = std::unique_ptr<Board>;
+
+//----
+
+class Turn {
+ public:
+  using Moves = std::vector<Move>;
+
+ public:
+  Turn(Game *game, int ind);
+
+  int ind() const { return ind_; }
+
+  const Moves &moves() const { return moves_; }
+
+  const Move &move(int i) { return moves_[i]; }
+
+  void addMove(const Move &move) { moves_.push_back(move); }
+
+  void popMove() { moves_.pop_back(); }
+
+  void clear() { moves_.clear(); }
+
+  int score() const;
+
+ private:
+  Game* game_ { nullptr };
+  int   ind_  { -1 };
+  Moves moves_;
+};
+
+//------
+
+// game state (tile set, players, board and turns) and turn rules
+class Game {
+ public:
+  using Turns = std::vector<Turn *>;
+
+ public:
+  Game();
+ ~Game();
+
+  int nx() const { return 18; }
+  int ny() const { return 12; }
+
+  int handSize() const { return 5; }
+
+  const TileSetP &tileSet() const { return tileSet_; }
+
+  const PlayerP &player1() const { return player1_; }
+  const PlayerP &player2() const { return player2_; }
+
+  TileOwner currentPlayerOwner() const { return currentPlayerOwner_; };
+
+  const PlayerP &currentPlayer() const { return ownerPlayer(currentPlayerOwner()); }
+
+  const PlayerP &ownerPlayer(TileOwner owner) const {
+    return (owner == TileOwner::PLAYER1 ? player1() : player2());
+  }
+
+  const BoardP &board() const { return board_; }
+
+  Turn *turn() const { return turn_; }
+
+  const Turns &turns() const { return turns_; }
+
+  //---
+
+  void init(Seed seed=0);
+
+  // tile set seed of current game
+  Seed seed() const { return tileSet_->seed(); }
+
+  //---
+
+  void addMove(const Move &move);
+
+  void undoMove(const Move &move);
+
+  void doMove(const Move &move);
+
+  void doMoveParts(const TileData &from, const TileData &to);
+
+  void nextTurn();
+
+  bool isGameOver() const { return gameOver_; }
+  void setGameOver(bool b) { gameOver_ = b; }
+
+  bool canMove() const;
+
+  ValidScore isTurnValid() const;
+
+  bool apply();
+
+  void cancel();
+
+  void back();
+
+  void newGame(Seed seed);
+
+  // get position at start of current turn (current turn tiles back in hand)
+  void getPosition(Position &position) const;
+
+  // replace game state with position (no turn history)
+  void setPosition(const Position &position);
+
+  int moveScore(const Move &move) const;
+
+ private:
+  TileSetP  tileSet_;
+  PlayerP   player1_;
+  PlayerP   player2_;
+  BoardP    board_;
+  Turn*     turn_     { nullptr };
+  Turns     turns_;
+
+  TileOwner currentPlayerOwner_ { TileOwner::PLAYER1 };
+
+  bool gameOver_ { false };
+};
+
+using GameP = std::unique_ptr<Game>;
+
+}
+
+#endif
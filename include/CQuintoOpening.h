@@ -0,0 +1,42 @@
+#ifndef CQuintoOpening_H
+#define CQuintoOpening_H
+
+#include <cstdint>
+
+namespace CQuinto {
+
+// best first turn (empty board and full hand) of a hand value multiset
+struct OpeningEntry {
+  static const int HAND_SIZE = 5;
+
+  uint32_t key;               // 1 then sorted hand values as decimal digits
+  uint16_t score;             // turn score
+  uint8_t  numPlacements;     // turn tiles (0 for no move)
+  uint8_t  cells [HAND_SIZE]; // placement cell indices (search move order)
+  uint8_t  values[HAND_SIZE]; // placement values
+};
+
+// table of best first turns for every hand value multiset (2002 for 5 tiles
+// of 10 values) so the first (largest) search of a game is a lookup.
+//
+// The table data (CQuintoOpeningData.cpp) is generated by CQuintoOpening
+// from the best move search, so a lookup gives the same move as the search.
+class OpeningTable {
+ public:
+  static const int HAND_SIZE = OpeningEntry::HAND_SIZE;
+
+ public:
+  // key of hand values (any order, values < 0 are ignored)
+  static uint32_t handKey(const int *values, int n);
+
+  // entry for key (nullptr if none)
+  static const OpeningEntry *find(uint32_t key);
+
+  static int numEntries();
+
+  static const OpeningEntry &entry(int i);
+};
+
+}
+
+#endif
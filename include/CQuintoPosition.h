@@ -0,0 +1,62 @@
+#ifndef CQuintoPosition_H
+#define CQuintoPosition_H
+
+#include <CQuintoEngine.h>
+
+#include <cstdint>
+#include <string>
+
+namespace CQuinto {
+
+// game position (board cells with value and placing player, both hands,
+// scores, current player, turn index and undrawn tiles) with one line text
+// notation :
+//
+//   <rows> <hand1>/<hand2> <score1>/<score2> <player> <turn> <tiles>
+//
+// rows : top to bottom separated by '/', each a sequence of empty cell
+//        counts (decimal) and tiles ('a'-'j' player 1 value 0-9, 'A'-'J'
+//        player 2 value 0-9) covering the 18 columns
+// hands: slot values ('0'-'9', '-' for empty slot)
+// tiles: undrawn tile values in draw order (drawn from end, '-' for none)
+//
+// e.g. first turn : 18/18/18/18/18/18/18/18/18/18/18/18 04365/71928 0/0 1 0 8745...
+//
+// Parse and write don't allocate (except to grow output string) so large
+// position sets can be loaded quickly.
+struct Position {
+  static const int NX        = BitBoard::NX;
+  static const int NY        = BitBoard::NY;
+  static const int HAND_SIZE = 5;
+  static const int MAX_TILES = 100;
+
+  // each turn places at least one tile or is a pass (not two in a row)
+  static const int MAX_TURNS = 2*MAX_TILES + 1;
+
+  int8_t    values[NY][NX];                   // cell values (-1 for empty)
+  TileOwner owners[NY][NX];                   // cell placing player
+  int8_t    hands [2][HAND_SIZE];             // player hand values (-1 for empty)
+  int       scores[2];                        // player scores
+  TileOwner player   { TileOwner::PLAYER1 };  // current player
+  int       turn     { 0 };                   // turn index
+  int8_t    tiles[MAX_TILES];                 // undrawn tile values
+  int       numTiles { 0 };                   // number of undrawn tiles
+
+  Position() { reset(); }
+
+  // empty board, hands and tile set
+  void reset();
+
+  // parse notation, returns false if invalid (position is then undefined)
+  bool parse(const char *str);
+  bool parse(const std::string &str) { return parse(str.c_str()); }
+
+  // append notation to string
+  void write(std::string &str) const;
+
+  std::string toString() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,196 @@
+#ifndef CQuintoRecord_H
+#define CQuintoRecord_H
+
+#include <CQuintoEngine.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CQuinto {
+
+// binary game record file (append only, read memory mapped).
+//
+// File is an 8 byte header ("CQGR", version) followed by game records. A
+// record is a fixed 20 byte header (record size, seed, variant, number of
+// turns and final scores, little endian) followed by each turn as its
+// number of placements (0 for pass) and the placements as (cell index,
+// value) byte pairs. The seed gives the tile order so the game can be
+// replayed from the placements.
+//
+// A game is the header plus 1 byte per turn and 2 bytes per placement, a
+// 30 turn self-play game is about 220 bytes.
+
+// turn placement (as stored in file, byte aligned)
+struct RecordPlacement {
+  uint8_t cell  { 0 }; // board cell index (BitBoard::cellInd)
+  uint8_t value { 0 }; // tile value
+
+  TilePosition pos() const {
+    return TilePosition(cell % BitBoard::NX, cell / BitBoard::NX);
+  }
+};
+
+// view of turn in record (points to record data, placements are read by
+// byte as mapped data is unaligned)
+struct RecordTurn {
+  int            numPlacements { 0 };       // 0 for pass
+  const uint8_t* data          { nullptr }; // placement (cell, value) bytes
+
+  RecordPlacement placement(int i) const {
+    RecordPlacement placement;
+
+    placement.cell  = data[2*i    ];
+    placement.value = data[2*i + 1];
+
+    return placement;
+  }
+};
+
+//---
+
+// view of game record data (no copy or parse)
+class GameRecord {
+ public:
+  static const int HEADER_SIZE = 20;
+
+ public:
+  GameRecord() = default;
+
+  GameRecord(const uint8_t *data, uint32_t size) :
+   data_(data), size_(size) {
+  }
+
+  const uint8_t *data() const { return data_; }
+
+  uint32_t size() const { return size_; }
+
+  Seed seed() const;
+
+  int variant() const { return data_[12]; }
+
+  int numTurns() const;
+
+  int score(int player) const;
+
+  // call fn(const RecordTurn &) for each turn
+  template<typename FN>
+  void visitTurns(FN fn) const {
+    const uint8_t *p = data_ + HEADER_SIZE;
+
+    int n = numTurns();
+
+    for (int i = 0; i < n; ++i) {
+      RecordTurn turn;
+
+      turn.numPlacements = *p++;
+      turn.data          = p;
+
+      p += 2*turn.numPlacements;
+
+      fn(turn);
+    }
+  }
+
+ private:
+  const uint8_t* data_ { nullptr };
+  uint32_t       size_ { 0 };
+};
+
+//---
+
+// builds record of single game (reused buffer)
+class GameRecordBuilder {
+ public:
+  static const int VARIANT_STANDARD = 0;
+
+ public:
+  GameRecordBuilder() = default;
+
+  void begin(Seed seed, int variant=VARIANT_STANDARD);
+
+  // add turn from current turn cells of board (none for pass)
+  void addTurn(const Board &board);
+
+  void addPass();
+
+  void end(int score1, int score2);
+
+  GameRecord record() const { return GameRecord(data_.data(), uint32_t(data_.size())); }
+
+ private:
+  using Data = std::vector<uint8_t>;
+
+  Data data_;               // record bytes
+  int  numTurns_ { 0 };     // turns added
+};
+
+//---
+
+// append only record file writer (thread safe)
+class GameRecordWriter {
+ public:
+  GameRecordWriter() = default;
+ ~GameRecordWriter();
+
+  GameRecordWriter(const GameRecordWriter &) = delete;
+  GameRecordWriter &operator=(const GameRecordWriter &) = delete;
+
+  // open file for append (header written if new), returns false on error
+  bool open(const std::string &filename);
+
+  void close();
+
+  // append complete record
+  bool write(const GameRecord &record);
+
+ private:
+  FILE*      fp_ { nullptr }; // file
+  std::mutex mutex_;          // write lock
+};
+
+//---
+
+// memory mapped record file reader (records are views of mapped data).
+//
+// Records are validated once on open (sizes, turns and placements) so next
+// only steps over record headers. Records from the first invalid (e.g.
+// truncated) record are not read.
+class GameRecordReader {
+ public:
+  GameRecordReader() = default;
+ ~GameRecordReader();
+
+  GameRecordReader(const GameRecordReader &) = delete;
+  GameRecordReader &operator=(const GameRecordReader &) = delete;
+
+  // map and validate file, returns false if missing or not a record file
+  bool open(const std::string &filename);
+
+  void close();
+
+  // first record
+  void rewind();
+
+  // next record, returns false at end of valid records
+  bool next(GameRecord &record);
+
+  // all records in file are valid
+  bool isComplete() const { return end_ == size_; }
+
+ private:
+  // size of valid record at data (0 if invalid)
+  static uint32_t validRecordSize(const uint8_t *data, size_t size);
+
+ private:
+  const uint8_t* data_ { nullptr }; // mapped file
+  size_t         size_ { 0 };       // file size
+  size_t         end_  { 0 };       // end of valid records
+  size_t         pos_  { 0 };       // next record offset
+};
+
+}
+
+#endif
@@ -0,0 +1,484 @@
+#ifndef CQuintoSearch_H
+#define CQuintoSearch_H
+
+#include <CQuintoEngine.h>
+
+#include <atomic>
+#include <chrono>
+#include <unordered_set>
+
+// Best move search on a compact copy of the board and searching player's
+// hand (no Qt dependency, never changes the game objects)
+namespace CQuinto {
+
+class ThreadPool;
+
+// random keys for (cell, value) used to hash set of placed tiles
+class Zobrist {
+ public:
+  using Key = uint64_t;
+
+  static const Zobrist &instance();
+
+  Key key(int ix, int iy, int value) const {
+    return keys_[BitBoard::cellInd(ix, iy)][value];
+  }
+
+ private:
+  Zobrist();
+
+ private:
+  Key keys_[BitBoard::NC][10];
+};
+
+//---
+
+// bit board, current turn cells and hand with make/unmake of single tile
+// placements (undone from small undo stack).
+//
+// The hand is searched as a value histogram (count per tile value) so equal
+// values in different slots are a single move. The player's hand slots are
+// kept only to map moves back to slots (slotMoves). Moves are generated in
+// value order, so of equal score and tiles moves the one chosen depends only
+// on the hand values, not their slot order (unlike the original per slot
+// move generation, so games differ move for move but not in score).
+class SearchState {
+ public:
+  static const int MAX_HAND   = Board::MAX_TURN_CELLS;
+  static const int MAX_CELLS  = Board::MAX_TURN_CELLS;
+  static const int NUM_VALUES = 10;
+
+ public:
+  SearchState() = default;
+
+  // copy board cells, current turn cells and player hand
+  void init(const Board &board, const Player &player, int turn);
+
+  const BitBoard &bits() const { return bits_; }
+
+  TileOwner owner() const { return owner_; }
+
+  int turn() const { return turn_; }
+
+  // player hand slots at init
+  int handSize() const { return handSize_; }
+
+  int handTile(int i) const { return hand_[i]; }
+
+  // count of remaining hand tiles with value
+  int valueCount(int value) const { return counts_[value]; }
+
+  // mask of values in remaining hand tiles
+  uint16_t valueMask() const { return valueMask_; }
+
+  int numTiles() const { return numTiles_; }
+
+  // mask of initial hand slots holding remaining hand values (first slots
+  // with each value, so same for same remaining values)
+  uint32_t slotMask() const { return slotMask_; }
+
+  int numTurnCells() const { return numTurnCells_; }
+
+  const TilePosition &turnCell(int i) const { return turnCells_[i]; }
+
+  // number of placements made since init
+  int depth() const { return numUndo_; }
+
+  // hash of placements made since init (same for any order)
+  Zobrist::Key key() const { return key_; }
+
+  // place hand tile value on board
+  void make(int value, const TilePosition &pos);
+
+  // undo last placement
+  void unmake();
+
+  // place tile of earlier turn (not current turn or hand tile)
+  void commitTile(const TilePosition &pos, int value, int turn, TileOwner owner);
+
+  const BoardDetails &details() const;
+
+ private:
+  struct Undo {
+    int          value { -1 };
+    TilePosition pos;
+  };
+
+  BitBoard             bits_;                   // cells
+  TilePosition         turnCells_[MAX_CELLS];   // current turn cells
+  int                  numTurnCells_ { 0 };     // number of current turn cells
+  int                  hand_[MAX_HAND];         // hand slot values (-1 for empty)
+  int                  handSize_     { 0 };     // hand size
+  int                  counts_[NUM_VALUES];     // remaining hand value counts
+  uint16_t             valueMask_    { 0 };     // remaining hand value mask
+  int                  numTiles_     { 0 };     // remaining hand tiles
+  int                  valueSlots_[NUM_VALUES][MAX_HAND]; // hand slots per value
+  uint32_t             slotMask_     { 0 };     // remaining hand slots mask
+  TileOwner            owner_        { TileOwner::NONE }; // searching player
+  int                  turn_         { 0 };     // turn index
+  Undo                 undo_[MAX_CELLS];        // undo stack
+  int                  numUndo_      { 0 };     // undo stack size
+  Zobrist::Key         key_          { 0 };     // placements hash
+  mutable BoardDetails details_;                // state details
+  mutable bool         detailsValid_ { false }; // are details current
+};
+
+//---
+
+// search move (hand value to board cell)
+struct SearchMove {
+  int          value { -1 };
+  TilePosition pos;
+};
+
+// valid search moves for state (and state score)
+struct SearchMoves {
+  using Moves = std::vector<SearchMove>;
+
+  int   depth   { 0 };
+  Moves moves;
+  int   score   { 0 };
+  bool  partial { false };
+  int   pruned  { 0 }; // moves removed by cross-checks
+};
+
+//---
+
+// move generator counts per depth (number of placed tiles) : valid states
+// (placement sequences) and distinct complete turns (placement sets)
+struct PerftCounts {
+  static const int MAX_DEPTH = Board::MAX_DEPTH;
+
+  long   nodes[MAX_DEPTH] { };  // valid states at depth
+  long   turns[MAX_DEPTH] { };  // distinct complete turns at depth
+  int    maxDepth  { 0 };       // max depth counted
+  double time      { 0.0 };     // wall time (seconds)
+
+  void reset() { *this = PerftCounts(); }
+
+  long totalNodes() const;
+  long totalTurns() const;
+
+  double nodesPerSec() const { return (time > 0.0 ? totalNodes()/time : 0.0); }
+
+  void print(std::ostream &os) const;
+};
+
+//---
+
+// set of placement hashes visited in current search (fixed size open
+// addressing table, entries from earlier searches invalidated by generation).
+//
+// Each entry stores the order (position in serial depth first search) of the
+// search task which visited it so a parallel search only skips placements
+// already visited by the same or an earlier task.
+class PlacementTable {
+ public:
+  static const int SIZE_BITS = 14;
+  static const int SIZE      = 1 << SIZE_BITS;
+  static const int MAX_PROBE = 8;
+
+ public:
+  PlacementTable();
+
+  void clear();
+
+  // add key visited by task order, returns false if already visited by
+  // same or earlier task
+  bool insert(Zobrist::Key key, uint64_t order=0);
+
+ private:
+  Zobrist::Key keys_[SIZE];
+  uint64_t     orders_[SIZE];
+  uint32_t     gens_[SIZE];
+  uint32_t     gen_ { 1 };
+};
+
+//---
+
+// score residues (mod 5) reachable with the remaining hand tiles. For each
+// sub hand (mask of initial hand slots) and number of tiles placed with
+// weight 1 (main line only) and weight 2 (main and cross line) stores the
+// mask of reachable weighted value sum residues
+class HandResidues {
+ public:
+  static const int MAX_HAND = SearchState::MAX_HAND;
+
+ public:
+  HandResidues() = default;
+
+  // calc residues for initial hand of state
+  void init(const SearchState &state);
+
+  uint8_t residues(uint32_t slotMask, int n1, int n2) const {
+    return residues_[slotMask][n1][n2];
+  }
+
+  // rotate residue mask by r (add r to each residue)
+  static uint8_t rotate(uint8_t mask, int r) {
+    r %= 5;
+
+    return uint8_t(((mask << r) | (mask >> (5 - r))) & 0x1f);
+  }
+
+ private:
+  uint8_t residues_[1 << MAX_HAND][MAX_HAND + 1][MAX_HAND + 1];
+};
+
+//---
+
+// time/node budget of search (shared by parallel search workers). Nodes are
+// added in batches so the clock is only read every few nodes
+class SearchBudget {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static const int CHECK_NODES = 64;
+
+ public:
+  SearchBudget(double timeLimit, long nodeLimit);
+
+  // add searched nodes, returns false if budget used
+  bool addNodes(int n);
+
+  bool isStopped() const { return stopped_.load(std::memory_order_relaxed); }
+
+ private:
+  Clock::time_point deadline_;                // time limit end
+  bool              hasDeadline_ { false };   // has time limit
+  long              nodeLimit_   { 0 };       // node limit (0 for none)
+  std::atomic<long> nodes_       { 0 };       // nodes searched
+  std::atomic<bool> stopped_     { false };   // budget used
+};
+
+//---
+
+// depth first best move search (or move tree build) from search state.
+//
+// The streaming search visits each set of placed tiles (cells and values)
+// once, a later permutation of the same placements is skipped as its
+// subtree (same board and remaining hand values) has already been searched.
+//
+// Once the turn line direction is fixed the subtree of a state is skipped
+// if no extension of the line by the remaining hand values can make the
+// turn score a multiple of 5 (mod 5 reachability) or, in bounded mode, if
+// an upper bound of its score can't beat the best move found so far. A
+// short probe search (best looking moves first) gives an initial best move
+// and bound.
+//
+// With more than one thread the search is split into tasks run on a work
+// stealing thread pool by per thread worker searches (each with its own
+// state copy). States above the split depth are single node tasks which add
+// a task per child move, states at the split depth search their whole
+// subtree. Task results are merged in serial search order so the best move
+// is the same as the serial search for any number of threads.
+//
+// With a time or node budget the search deepens by number of turn tiles
+// (best 1 tile turn, then up to 2 tiles, ...) so a good complete turn is
+// found early, and returns the best move found when the budget is used.
+class Search {
+ public:
+  using Moves = std::vector<Move>;
+
+  static const int MAX_DEPTH   = Board::MAX_DEPTH;
+  static const int PROBE_NODES = 256;
+
+ public:
+  Search();
+ ~Search();
+
+  // copy board and player state to search
+  void init(const Board &board, const Player &player, int turn);
+
+  const SearchState &state() const { return state_; }
+
+  // build full move tree for best move search (debug/analysis)
+  bool isTree() const { return tree_; }
+  void setTree(bool b) { tree_ = b; }
+
+  // skip subtrees which can't beat best move (streaming search)
+  bool isBounded() const { return bounded_; }
+  void setBounded(bool b) { bounded_ = b; }
+
+  // use opening table for first turn (empty board and full hand)
+  bool isOpenings() const { return openings_; }
+  void setOpenings(bool b) { openings_ = b; }
+
+  // number of threads for streaming search (1 for serial search, 0 for
+  // hardware thread count)
+  int numThreads() const { return numThreads_; }
+  void setNumThreads(int n);
+
+  // depth of subtree tasks for parallel search (1 for root moves)
+  int splitDepth() const { return splitDepth_; }
+  void setSplitDepth(int depth);
+
+  // best move search budget (time in seconds and nodes, 0 for no limit)
+  double timeLimit() const { return timeLimit_; }
+  long nodeLimit() const { return nodeLimit_; }
+
+  void setBudget(double timeLimit, long nodeLimit) {
+    timeLimit_ = timeLimit; nodeLimit_ = nodeLimit;
+  }
+
+  // cancel flag (set from other thread) stops search at next node (result
+  // is best move found so far)
+  void setCancel(const std::atomic<bool> *cancel) { cancel_ = cancel; }
+
+  bool isCancelled() const {
+    return (cancel_ && cancel_->load(std::memory_order_relaxed));
+  }
+
+  const SearchStats &stats() const { return stats_; }
+
+  // best score found by probe search of last best move search (-1 if none)
+  int probeScore() const { return probeScore_; }
+
+  // calc best move (max score, fewest tiles) for state
+  void calcBestMove(BestMove &bestMove);
+
+  // check if state has any complete (valid, multiple of 5) move, stops at
+  // first found
+  bool hasMove();
+
+  // build full move tree for state
+  MoveTree *moveTree();
+
+  // count all move generator states and distinct complete turns up to max
+  // depth (no duplicate or score pruning) to validate move generation
+  void perft(int maxDepth, PerftCounts &counts);
+
+  // get moves (distinct hand value to valid position) for state
+  bool stateMoves(SearchMoves &moves) const;
+
+  // map search move stack to player hand slot moves
+  void slotMoves(int depth, Moves &moves) const;
+
+  // place tiles of move found by other search (other player) as tiles of
+  // its turn (speculative board for reply search)
+  void commitMove(const Search &search, const BestMove &move);
+
+ private:
+  void calcTreeBestMove(BestMove &bestMove);
+
+  bool lookupOpening(BestMove &bestMove);
+
+  void searchBestMove(int depth);
+
+  void searchTiles();
+
+  bool searchNode(int depth);
+
+  bool checkBudget();
+
+  void calcParallelBestMove();
+
+  void initWorker(Search *search, std::atomic<int> *sharedScore);
+
+  // parallel search task : state after moves from root state. Order is
+  // position of state in serial search (child move index + 1 per depth)
+  struct SearchTask {
+    SearchMove moves[MAX_DEPTH];
+    int        depth { 0 };
+    uint64_t   order { 0 };
+  };
+
+  // best move found by task
+  struct TaskResult {
+    uint64_t order { 0 };
+    BestMove bestMove;
+  };
+
+  static const int ORDER_BITS = 12;
+
+  void addTask(const SearchTask &task);
+
+  void runTask(const SearchTask &task);
+
+  void updateSharedScore(int score);
+
+  bool buildMoveTree(MoveTree *tree, int depth);
+
+  using PerftKeys = std::unordered_set<Zobrist::Key>;
+
+  void perftNode(int depth, int maxDepth, PerftCounts &counts, PerftKeys &keys);
+
+  Move slotMove(int depth) const;
+
+  // line extension by one tile : score weight of tile value (2 if it
+  // also makes a cross line), added existing tile sum (cross line and
+  // joined run) and added line length
+  struct LineExtend {
+    int weight { 1 };
+    int sum    { 0 };
+    int len    { 0 };
+  };
+
+  // extensions of turn line to left/right (top/bottom)
+  struct LineExtends {
+    int        lineLen { 0 };
+    LineExtend left [SearchState::MAX_HAND];
+    LineExtend right[SearchState::MAX_HAND];
+    int        nl      { 0 };
+    int        nr      { 0 };
+  };
+
+  void probeBestMove(int depth);
+
+  bool findMove(int depth);
+
+  bool canBeatBest(int depth, int maxScore) const;
+
+  bool lineExtends(LineExtends &extends) const;
+
+  template<typename FN>
+  bool visitExtends(const LineExtends &extends, FN fn) const;
+
+  bool canReachMultiple5(int score, const LineExtends &extends) const;
+
+  int upperBound(int score, const LineExtends &extends) const;
+
+ private:
+  SearchState state_;                    // search state
+  bool        tree_      { false };      // build move tree
+  bool        bounded_   { true };       // skip subtrees by score bound
+  bool        openings_  { true };       // first turn from opening table
+  SearchMoves depthMoves_[MAX_DEPTH];    // reused per depth move lists
+  SearchMove  moves_[MAX_DEPTH];         // current search move stack
+  BestMove*   bestMove_  { nullptr };    // best move (streaming search)
+  bool        found_     { false };      // search has found best move
+  int         probeScore_ { -1 };        // probe search best score
+  int         probeNodes_ { 0 };         // probe search nodes left
+  bool        probeBest_  { false };     // best move is from probe search
+  SearchStats stats_;                    // search stats
+
+  PlacementTable visited_;               // visited placement sets
+  HandResidues   residues_;              // hand score residues
+
+  using ThreadPoolP = std::unique_ptr<ThreadPool>;
+  using SearchP     = std::unique_ptr<Search>;
+  using Workers     = std::vector<SearchP>;
+  using TaskResults = std::vector<TaskResult>;
+
+  int               numThreads_  { 1 };       // search threads
+  int               splitDepth_  { 2 };       // subtree task depth
+  ThreadPoolP       pool_;                    // worker threads
+  Workers           workers_;                 // per thread worker searches
+  Search*           parent_      { nullptr }; // parallel search (worker)
+  uint64_t          order_       { 0 };       // current task order
+  TaskResults       results_;                 // task results (worker)
+  std::atomic<int>* sharedScore_ { nullptr }; // best score of all workers
+
+  const std::atomic<bool>* cancel_ { nullptr }; // cancel search flag
+
+  double        timeLimit_   { 0.0 };     // search time limit (seconds)
+  long          nodeLimit_   { 0 };       // search node limit
+  SearchBudget* budget_      { nullptr }; // current search budget
+  int           budgetNodes_ { 0 };       // nodes not yet added to budget
+  int           maxTiles_    { Board::MAX_TURN_CELLS }; // turn tiles limit
+  bool          limited_     { false };   // moves skipped by tiles limit
+};
+
+}
+
+#endif
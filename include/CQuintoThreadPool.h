@@ -0,0 +1,73 @@
+#ifndef CQuintoThreadPool_H
+#define CQuintoThreadPool_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CQuinto {
+
+// fixed size pool of worker threads with a task deque per thread (work
+// stealing).
+//
+// Tasks added from a worker thread (sub tasks) go to the back of its own
+// deque and are run newest first (depth first, keeps deque small), idle
+// threads steal the oldest (largest) task from the front of other deques.
+class ThreadPool {
+ public:
+  // task is passed index of worker thread running it
+  using Task = std::function<void(int thread)>;
+
+ public:
+  ThreadPool(int numThreads);
+ ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  int numThreads() const { return int(queues_.size()); }
+
+  // queue task (on own deque for worker thread, otherwise next deque)
+  void add(const Task &task);
+
+  // wait for all queued tasks (and tasks they add) to complete
+  void wait();
+
+  // number of tasks taken from other threads deques (since construction)
+  int numSteals() const { return numSteals_; }
+
+ private:
+  void run(int thread);
+
+  bool popTask(int thread, Task &task);
+
+ private:
+  struct Queue {
+    std::mutex       mutex;
+    std::deque<Task> tasks;
+  };
+
+  using QueueP  = std::unique_ptr<Queue>;
+  using Queues  = std::vector<QueueP>;
+  using Threads = std::vector<std::thread>;
+
+  Queues                  queues_;                // per thread task deques
+  Threads                 threads_;               // worker threads
+  std::atomic<int>        numQueued_  { 0 };      // tasks in deques
+  std::atomic<int>        numPending_ { 0 };      // tasks queued or running
+  std::atomic<int>        numSteals_  { 0 };      // tasks stolen
+  std::atomic<int>        nextQueue_  { 0 };      // deque for external task
+  bool                    stop_       { false };  // stop worker threads
+  std::mutex              mutex_;                 // sleep/wake lock
+  std::condition_variable taskCond_;              // task queued (or stop)
+  std::condition_variable doneCond_;              // all tasks complete
+};
+
+}
+
+#endif
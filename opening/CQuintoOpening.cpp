@@ -0,0 +1,208 @@
+#include <CQuintoOpening.h>
+#include <CQuintoSearch.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// opening table generator and checker.
+//
+// Searches the best first turn (empty board) of every hand value multiset
+// and writes the table data source (-generate <file>), or checks the
+// compiled table gives the same best move as the search for every
+// multiset in several hand slot orders (default) and reports the lookup
+// and search times.
+
+using namespace CQuinto;
+
+namespace {
+
+const int HAND_SIZE = OpeningTable::HAND_SIZE;
+
+using Hand  = std::vector<int>;
+using Hands = std::vector<Hand>;
+
+// all sorted hands (multisets) of hand size values 0-9
+void allHands(Hands &hands) {
+  Hand hand(HAND_SIZE);
+
+  std::function<void(int, int)> addValues = [&](int i, int value) {
+    if (i == HAND_SIZE) {
+      hands.push_back(hand);
+      return;
+    }
+
+    for (int v = value; v < 10; ++v) {
+      hand[i] = v;
+
+      addValues(i + 1, v);
+    }
+  };
+
+  addValues(0, 0);
+}
+
+// set player 1 hand of new game (first turn, empty board)
+void setHand(Game &game, const Hand &hand) {
+  auto *player = game.player1().get();
+
+  for (int i = 0; i < HAND_SIZE; ++i) {
+    (void) player->takeTile(i, /*nocheck*/true);
+
+    player->addTile(hand[i], i);
+  }
+}
+
+// best first turn of hand (search or table lookup)
+void calcBestMove(const Hand &hand, bool openings, BestMove &bestMove, double &time) {
+  Game game;
+
+  game.init();
+
+  setHand(game, hand);
+
+  Search search;
+
+  game.board()->initSearch(search, *game.player1(), 0);
+
+  search.setOpenings(openings);
+
+  search.calcBestMove(bestMove);
+
+  time += search.stats().time;
+}
+
+bool sameBestMove(const BestMove &lhs, const BestMove &rhs) {
+  if (lhs.score != rhs.score || lhs.moves.size() != rhs.moves.size())
+    return false;
+
+  for (size_t i = 0; i < lhs.moves.size(); ++i) {
+    if (! (lhs.moves[i].from().pos == rhs.moves[i].from().pos) ||
+        ! (lhs.moves[i].to  ().pos == rhs.moves[i].to  ().pos))
+      return false;
+  }
+
+  return true;
+}
+
+int generate(const std::string &filename) {
+  std::ofstream os(filename);
+
+  if (! os) {
+    std::cerr << "Failed to open '" << filename << "'\n";
+    return 1;
+  }
+
+  Hands hands;
+
+  allHands(hands);
+
+  os << "#include <CQuintoOpening.h>\n\n";
+  os << "// generated by CQuintoOpening -generate (do not edit)\n\n";
+  os << "namespace CQuinto {\n\n";
+  os << "extern const OpeningEntry s_openingEntries[] = {\n";
+
+  double time = 0.0;
+
+  for (const auto &hand : hands) {
+    BestMove bestMove;
+
+    calcBestMove(hand, /*openings*/false, bestMove, time);
+
+    int n = int(bestMove.moves.size());
+
+    int cells[HAND_SIZE] = { 0 }, values[HAND_SIZE] = { 0 };
+
+    for (int i = 0; i < n; ++i) {
+      const auto &pos = bestMove.moves[i].to().pos;
+
+      cells [i] = BitBoard::cellInd(pos.ix, pos.iy);
+      values[i] = hand[bestMove.moves[i].from().pos.ix];
+    }
+
+    os << "  { " << OpeningTable::handKey(hand.data(), HAND_SIZE) << ", " <<
+          bestMove.score << ", " << n << ", {";
+
+    for (int i = 0; i < HAND_SIZE; ++i)
+      os << (i > 0 ? "," : "") << cells[i];
+
+    os << "}, {";
+
+    for (int i = 0; i < HAND_SIZE; ++i)
+      os << (i > 0 ? "," : "") << values[i];
+
+    os << "} },\n";
+  }
+
+  os << "};\n\n";
+  os << "extern const int s_numOpeningEntries = " << hands.size() << ";\n\n";
+  os << "}\n";
+
+  std::cout << "entries=" << hands.size() << " search time=" << time*1000.0 << "ms\n";
+
+  return 0;
+}
+
+int check() {
+  Hands hands;
+
+  allHands(hands);
+
+  int numMismatches = 0, numHands = 0;
+
+  double searchTime = 0.0, lookupTime = 0.0;
+
+  for (auto hand : hands) {
+    // sorted and rotated slot orders
+    for (int r = 0; r < HAND_SIZE; ++r) {
+      BestMove searchMove, lookupMove;
+
+      calcBestMove(hand, /*openings*/false, searchMove, searchTime);
+      calcBestMove(hand, /*openings*/true , lookupMove, lookupTime);
+
+      if (! sameBestMove(searchMove, lookupMove))
+        ++numMismatches;
+
+      ++numHands;
+
+      std::rotate(hand.begin(), hand.begin() + 1, hand.end());
+    }
+  }
+
+  std::cout << "entries=" << OpeningTable::numEntries() << " hands=" << numHands <<
+               " mismatches=" << numMismatches << "\n";
+  std::cout << "search time=" << searchTime*1000.0 << "ms" <<
+               " lookup time=" << lookupTime*1000.0 << "ms\n";
+
+  return (numMismatches == 0 ? 0 : 1);
+}
+
+void usage() {
+  std::cerr << "CQuintoOpening [-generate <file>]\n";
+}
+
+}
+
+int
+main(int argc, char **argv)
+{
+  std::string generateFile;
+
+  for (int i = 1; i < argc; ++i) {
+    auto arg = argv[i];
+
+    if (strcmp(arg, "-generate") == 0 && i < argc - 1) generateFile = argv[++i];
+    else { usage(); return 1; }
+  }
+
+  if (generateFile != "")
+    return generate(generateFile);
+
+  return check();
+}
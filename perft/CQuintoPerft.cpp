@@ -0,0 +1,257 @@
+#include <CQuintoPosition.h>
+#include <CQuintoSearch.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// move generator counter (perft) and validator.
+//
+// For a position (board and hand) counts valid search states (placement
+// sequences) and distinct complete turns (placement sets) at each depth
+// with no duplicate or score pruning. Checks the counts of the reference
+// positions (default) or counts a position of a seeded computer vs computer
+// game (-seed/-turn, -print outputs it as a reference entry) or of a
+// position notation (-position). Also reports raw move generation
+// throughput (nodes/s).
+
+using namespace CQuinto;
+
+namespace {
+
+const int MAX_DEPTH = PerftCounts::MAX_DEPTH;
+
+// reference position (notation) and counts for depths 0 to 5
+struct PerftPosition {
+  const char *name;
+  const char *position;
+  long        nodes[MAX_DEPTH];
+  long        turns[MAX_DEPTH];
+};
+
+const PerftPosition s_positions[] = {
+  { "seed 1 turn 0",
+    "18/18/18/18/18/18/18/18/18/18/18/18 04365/83473 0/0 1 0 79901797886904166014988610793042157466818524579964477652309289878779873593284672",
+    { 1, 5, 80, 480, 1920, 0 },
+    { 0, 2, 16, 72, 192, 0 } },
+  { "seed 3 turn 0",
+    "18/18/18/18/18/18/18/18/18/18/18/18 77272/05918 0/0 1 0 57341467116892793689370745614876039583486874008807722968428183634999546995097467",
+    { 1, 2, 16, 56, 160, 320 },
+    { 0, 0, 0, 0, 0, 100 } },
+  { "seed 1 turn 4",
+    "18/18/9C8/6dghD8/5EDHII8/6gfeE8/18/18/18/18/18/18 02953/78973 80/140 1 4 799017978869041660149886107930421574668185245799644776523092898787",
+    { 1, 37, 408, 2004, 3312, 0 },
+    { 0, 8, 87, 181, 254, 0 } },
+  { "seed 2 turn 8",
+    "18/4bgEjA9/5FDc10/4JCHcA9/4jBIfH9/4jGihf9/4h3D9/4B13/18/18/18/18 21872/52870 215/245 1 8 086077969063935748419406467544879387917643943887946868",
+    { 1, 24, 195, 726, 1248, 1416 },
+    { 0, 3, 35, 76, 183, 204 } },
+  { "seed 5 turn 8",
+    "18/4E13/4DEFH10/4iiij10/4FCEHH9/4Ajiee9/6fdbj8/8gjj7/9IIG6/18/18/18 71402/14437 280/290 1 8 689775360682561977965787607991322462930880776018943",
+    { 1, 44, 378, 1718, 4284, 0 },
+    { 0, 12, 78, 212, 248, 0 } },
+  { "seed 3 turn 16",
+    "18/3fgi12/3AAFJ11/3ghhj11/4FIJJJ9/4hhhcc1B7/6gejeC3F3/7BIJG1IcD3/7eciJ1EhJ3/9hhdIa4/11AIIG3/13ied2 67348/41600 550/570 1 16 57341467116892793689370745",
+    { 1, 54, 460, 1558, 3900, 0 },
+    { 0, 13, 107, 179, 316, 0 } },
+  { "seed 1 turn 16",
+    "18/18/5f3C8/5gdghD8/5EDHII8/5ggfeE8/6afjdi7/4ADIHH1hCaB1i2/5e3BhJcG1e2/5h3IiJdH1c2/9C1IfHjg2/9E1HFJjf2 39701/62448 550/640 1 16 7990179788690416601498",
+    { 1, 61, 860, 3712, 9072, 11832 },
+    { 0, 13, 135, 396, 680, 302 } },
+  { "seed 1 turn 20",
+    "2bij13/2hdbj12/2IGEf3CCE6/GBEG1gdghD8/5EDHII8/5ggfeE8/6afjdi7/4ADIHH1hCaB1i2/5e3BhJcG1e2/5h3IiJdH1c2/9C1IfHjg2/9E1HFJjf2 09406/08879 665/760 1 20 799017",
+    { 1, 75, 744, 2568, 5064, 3192 },
+    { 0, 15, 103, 262, 300, 24 } },
+};
+
+// print position of game as reference entry
+void printPosition(const Game &game, const std::string &name, const PerftCounts &counts) {
+  Position position;
+
+  game.getPosition(position);
+
+  std::cout << "  { \"" << name << "\",\n    \"" << position.toString() << "\",\n    {";
+
+  for (int i = 0; i < MAX_DEPTH; ++i)
+    std::cout << (i > 0 ? ", " : " ") << counts.nodes[i];
+
+  std::cout << " },\n    {";
+
+  for (int i = 0; i < MAX_DEPTH; ++i)
+    std::cout << (i > 0 ? ", " : " ") << counts.turns[i];
+
+  std::cout << " } },\n";
+}
+
+// play seeded computer vs computer game to turn
+void playToTurn(Game &game, int turn) {
+  game.player1()->setType(PlayerType::COMPUTER);
+  game.player2()->setType(PlayerType::COMPUTER);
+
+  auto *board = game.board().get();
+
+  while (! game.isGameOver() && game.turn()->ind() < turn) {
+    if (! game.currentPlayer()->canMove()) {
+      game.nextTurn();
+
+      if (! game.currentPlayer()->canMove())
+        game.setGameOver(true);
+
+      continue;
+    }
+
+    if (! board->playBestMove())
+      break;
+
+    game.apply();
+  }
+}
+
+// perft current player of game (repeated for timing)
+void runPerft(const Game &game, int turn, int depth, int repeat, PerftCounts &counts) {
+  Search search;
+
+  game.board()->initSearch(search, *game.currentPlayer(), turn);
+
+  double time = 0.0;
+
+  for (int i = 0; i < repeat; ++i) {
+    search.perft(depth, counts);
+
+    time += counts.time;
+  }
+
+  counts.time = time/repeat;
+}
+
+void usage() {
+  std::cerr << "CQuintoPerft [-depth <n>] [-repeat <n>] "
+               "[-seed <n> -turn <n> [-print] | -position <str>] [-v]\n";
+}
+
+}
+
+int
+main(int argc, char **argv)
+{
+  Seed seed     = 0;
+  bool hasSeed  = false;
+  int  turn     = 0;
+  int  depth    = Board::MAX_TURN_CELLS;
+  int  repeat   = 1;
+  bool print    = false;
+  bool verbose  = false;
+
+  const char *positionStr = nullptr;
+
+  for (int i = 1; i < argc; ++i) {
+    auto arg = argv[i];
+
+    if      (strcmp(arg, "-seed"    ) == 0 && i < argc - 1) { seed = strtoull(argv[++i], nullptr, 10);
+                                                              hasSeed = true; }
+    else if (strcmp(arg, "-turn"    ) == 0 && i < argc - 1) turn        = atoi(argv[++i]);
+    else if (strcmp(arg, "-depth"   ) == 0 && i < argc - 1) depth       = atoi(argv[++i]);
+    else if (strcmp(arg, "-repeat"  ) == 0 && i < argc - 1) repeat      = atoi(argv[++i]);
+    else if (strcmp(arg, "-position") == 0 && i < argc - 1) positionStr = argv[++i];
+    else if (strcmp(arg, "-print"   ) == 0)                 print       = true;
+    else if (strcmp(arg, "-v"       ) == 0)                 verbose     = true;
+    else { usage(); return 1; }
+  }
+
+  depth  = std::min(std::max(depth, 0), Board::MAX_TURN_CELLS);
+  repeat = std::max(repeat, 1);
+
+  //---
+
+  // count position of seeded game or position notation
+  if (hasSeed || positionStr) {
+    Game game;
+
+    game.init(seed);
+
+    if (positionStr) {
+      Position position;
+
+      if (! position.parse(positionStr)) {
+        std::cerr << "Invalid position '" << positionStr << "'\n";
+        return 1;
+      }
+
+      game.setPosition(position);
+    }
+    else
+      playToTurn(game, turn);
+
+    PerftCounts counts;
+
+    runPerft(game, game.turn()->ind(), depth, repeat, counts);
+
+    if (print)
+      printPosition(game, "seed " + std::to_string(seed) + " turn " +
+                    std::to_string(game.turn()->ind()), counts);
+    else
+      counts.print(std::cout);
+
+    return 0;
+  }
+
+  //---
+
+  // check reference positions
+  int  numFailed  = 0;
+  long totalNodes = 0;
+  double totalTime = 0.0;
+
+  for (const auto &position : s_positions) {
+    Position gamePosition;
+
+    if (! gamePosition.parse(position.position)) {
+      std::cerr << "Invalid position '" << position.position << "'\n";
+      return 1;
+    }
+
+    Game game;
+
+    game.init();
+
+    game.setPosition(gamePosition);
+
+    PerftCounts counts;
+
+    runPerft(game, gamePosition.turn, depth, repeat, counts);
+
+    bool ok = true;
+
+    for (int i = 0; i <= depth; ++i) {
+      if (counts.nodes[i] != position.nodes[i] || counts.turns[i] != position.turns[i])
+        ok = false;
+    }
+
+    if (! ok)
+      ++numFailed;
+
+    totalNodes += counts.totalNodes();
+    totalTime  += counts.time;
+
+    std::cout << std::left << std::setw(20) << position.name << std::right <<
+                 (ok ? " ok  " : " FAIL") <<
+                 " nodes=" << std::setw(9) << counts.totalNodes() <<
+                 " turns=" << std::setw(6) << counts.totalTurns() <<
+                 " nodes/s=" << long(counts.nodesPerSec()) << "\n";
+
+    if (verbose || ! ok) {
+      for (int i = 0; i <= depth; ++i)
+        std::cout << "  depth=" << i <<
+                     " nodes=" << counts.nodes[i] << " (" << position.nodes[i] << ")" <<
+                     " turns=" << counts.turns[i] << " (" << position.turns[i] << ")\n";
+    }
+  }
+
+  std::cout << "positions=" << (sizeof(s_positions)/sizeof(s_positions[0])) <<
+               " failed=" << numFailed << " depth=" << depth <<
+               " nodes/s=" << long(totalTime > 0.0 ? totalNodes/totalTime : 0.0) << "\n";
+
+  return (numFailed == 0 ? 0 : 1);
+}
@@ -0,0 +1,31 @@
+TEMPLATE = app
+
+TARGET = CQuintoPerft
+
+CONFIG -= qt
+CONFIG += console thread
+
+DEPENDPATH += .
+
+QMAKE_CXXFLAGS += -std=c++17
+
+#CONFIG += debug
+
+# Input
+SOURCES += \
+CQuintoPerft.cpp \
+
+DESTDIR     = ../bin
+OBJECTS_DIR = ../obj
+LIB_DIR     = ../lib
+
+INCLUDEPATH += \
+../include \
+.
+
+PRE_TARGETDEPS = \
+$$LIB_DIR/libCQuintoEngine.a \
+
+unix:LIBS += \
+-L$$LIB_DIR \
+-lCQuintoEngine \
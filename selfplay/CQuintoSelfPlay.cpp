@@ -0,0 +1,322 @@
+#include <CQuintoEngine.h>
+#include <CQuintoRecord.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// headless computer vs computer self play.
+//
+// Plays seeded games (game i uses seed + i) in parallel, one game per
+// thread at a time, and reports throughput (games/s, turns/s, search
+// nodes/s) and average scores and game length. Games can be appended to a
+// binary game record file (-record) and a record file replayed to check
+// the recorded scores (-replay).
+
+using namespace CQuinto;
+
+namespace {
+
+const int MAX_TURNS = 400;
+
+struct GameResult {
+  int    score1 { 0 };   // player 1 score
+  int    score2 { 0 };   // player 2 score
+  int    turns  { 0 };   // number of turns (including passes)
+  int    moves  { 0 };   // number of played (non pass) turns
+  long   nodes  { 0 };   // best move search nodes
+  double time   { 0.0 }; // game time (seconds)
+};
+
+struct Options {
+  Seed        seed       { 1 };     // first game seed
+  int         numGames   { 100 };   // number of games
+  int         numThreads { 1 };     // number of game threads
+  double      timeLimit  { 0.0 };   // per move search time limit
+  long        nodeLimit  { 0 };     // per move search node limit
+  bool        verbose    { false }; // print per game result
+  std::string recordFile;           // game record file (append)
+  std::string replayFile;           // game record file to replay
+};
+
+void playGame(const Options &options, int ind, GameRecordWriter *writer, GameResult &result) {
+  auto startTime = std::chrono::steady_clock::now();
+
+  Game game;
+
+  game.init(options.seed + ind);
+
+  game.player1()->setType(PlayerType::COMPUTER);
+  game.player2()->setType(PlayerType::COMPUTER);
+
+  auto *board = game.board().get();
+
+  board->setSearchTimeLimit(options.timeLimit);
+  board->setSearchNodeLimit(options.nodeLimit);
+
+  GameRecordBuilder builder;
+
+  if (writer)
+    builder.begin(game.seed());
+
+  while (! game.isGameOver() && result.turns < MAX_TURNS) {
+    ++result.turns;
+
+    if (! game.currentPlayer()->canMove()) {
+      if (writer)
+        builder.addPass();
+
+      game.nextTurn();
+
+      if (! game.currentPlayer()->canMove())
+        game.setGameOver(true);
+
+      continue;
+    }
+
+    if (! board->playBestMove())
+      break;
+
+    result.nodes += board->searchStats().nodes;
+
+    ++result.moves;
+
+    if (writer)
+      builder.addTurn(*board);
+
+    game.apply();
+  }
+
+  result.score1 = game.player1()->score();
+  result.score2 = game.player2()->score();
+
+  if (writer) {
+    builder.end(result.score1, result.score2);
+
+    writer->write(builder.record());
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+  result.time = elapsed.count();
+}
+
+// replay recorded game (placed values taken from first matching hand slot),
+// returns false if placements invalid or final scores differ from record
+bool replayGame(const GameRecord &record) {
+  Game game;
+
+  game.init(record.seed());
+
+  bool ok = true;
+
+  record.visitTurns([&](const RecordTurn &turn) {
+    if (! ok)
+      return;
+
+    if (turn.numPlacements == 0) {
+      game.nextTurn();
+      return;
+    }
+
+    const auto &player = game.currentPlayer();
+
+    for (int i = 0; i < turn.numPlacements; ++i) {
+      auto placement = turn.placement(i);
+
+      int slot = -1;
+
+      for (int j = 0; j < game.handSize(); ++j) {
+        if (player->tile(j) == placement.value) {
+          slot = j;
+          break;
+        }
+      }
+
+      if (slot < 0 || game.board()->hasCell(placement.pos())) {
+        ok = false;
+        return;
+      }
+
+      game.doMove(Move(TileData(player->owner(), TilePosition(slot, 0)),
+                       TileData(TileOwner::BOARD, placement.pos())));
+    }
+
+    if (! game.apply())
+      ok = false;
+  });
+
+  return (ok && game.player1()->score() == record.score(0) &&
+                game.player2()->score() == record.score(1));
+}
+
+// read record file (zero copy scan) and replay its games
+int replayGames(const Options &options) {
+  GameRecordReader reader;
+
+  if (! reader.open(options.replayFile)) {
+    std::cerr << "Failed to open record file '" << options.replayFile << "'\n";
+    return 1;
+  }
+
+  if (! reader.isComplete())
+    std::cerr << "Invalid record in '" << options.replayFile <<
+                 "' (it and later records are not replayed)\n";
+
+  long numGames = 0, numTurns = 0, numPlacements = 0, numMismatches = 0;
+
+  GameRecord record;
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  while (reader.next(record)) {
+    ++numGames;
+
+    numTurns += record.numTurns();
+
+    record.visitTurns([&](const RecordTurn &turn) { numPlacements += turn.numPlacements; });
+  }
+
+  std::chrono::duration<double> scanElapsed = std::chrono::steady_clock::now() - startTime;
+
+  reader.rewind();
+
+  while (reader.next(record)) {
+    if (! replayGame(record)) {
+      ++numMismatches;
+
+      if (options.verbose)
+        std::cout << "mismatch seed=" << record.seed() << "\n";
+    }
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+  double scanTime   = scanElapsed.count();
+  double replayTime = elapsed.count() - scanTime;
+
+  std::cout << std::fixed << std::setprecision(2);
+
+  std::cout << "games=" << numGames << " turns=" << numTurns <<
+               " placements=" << numPlacements << " mismatches=" << numMismatches << "\n";
+  std::cout << "scan games/s=" << (scanTime > 0.0 ? numGames/scanTime : 0.0) <<
+               " replay games/s=" << (replayTime > 0.0 ? numGames/replayTime : 0.0) << "\n";
+
+  return (numMismatches == 0 && reader.isComplete() ? 0 : 1);
+}
+
+void usage() {
+  std::cerr << "CQuintoSelfPlay [-games <n>] [-seed <n>] [-threads <n>] "
+               "[-time <secs>] [-nodes <n>] [-record <file>] [-v]\n"
+               "CQuintoSelfPlay -replay <file> [-v]\n";
+}
+
+}
+
+int
+main(int argc, char **argv)
+{
+  Options options;
+
+  options.numThreads = std::max(int(std::thread::hardware_concurrency()), 1);
+
+  for (int i = 1; i < argc; ++i) {
+    auto arg = argv[i];
+
+    if      (strcmp(arg, "-games"  ) == 0 && i < argc - 1) options.numGames   = atoi(argv[++i]);
+    else if (strcmp(arg, "-seed"   ) == 0 && i < argc - 1) options.seed       = strtoull(argv[++i], nullptr, 10);
+    else if (strcmp(arg, "-threads") == 0 && i < argc - 1) options.numThreads = atoi(argv[++i]);
+    else if (strcmp(arg, "-time"   ) == 0 && i < argc - 1) options.timeLimit  = atof(argv[++i]);
+    else if (strcmp(arg, "-nodes"  ) == 0 && i < argc - 1) options.nodeLimit  = atol(argv[++i]);
+    else if (strcmp(arg, "-record" ) == 0 && i < argc - 1) options.recordFile = argv[++i];
+    else if (strcmp(arg, "-replay" ) == 0 && i < argc - 1) options.replayFile = argv[++i];
+    else if (strcmp(arg, "-v"      ) == 0)                 options.verbose    = true;
+    else { usage(); return 1; }
+  }
+
+  if (options.replayFile != "")
+    return replayGames(options);
+
+  options.numGames   = std::max(options.numGames  , 0);
+  options.numThreads = std::max(std::min(options.numThreads, options.numGames), 1);
+
+  GameRecordWriter writer;
+
+  if (options.recordFile != "" && ! writer.open(options.recordFile)) {
+    std::cerr << "Failed to open record file '" << options.recordFile << "'\n";
+    return 1;
+  }
+
+  auto *recordWriter = (options.recordFile != "" ? &writer : nullptr);
+
+  //---
+
+  // each thread plays next unplayed game
+  std::vector<GameResult> results(options.numGames);
+
+  std::atomic<int> nextGame(0);
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < options.numThreads; ++i) {
+    threads.emplace_back([&]() {
+      int ind;
+
+      while ((ind = nextGame++) < options.numGames)
+        playGame(options, ind, recordWriter, results[ind]);
+    });
+  }
+
+  for (auto &thread : threads)
+    thread.join();
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+  double time = elapsed.count();
+
+  //---
+
+  long totalScore1 = 0, totalScore2 = 0, totalTurns = 0, totalMoves = 0, totalNodes = 0;
+
+  for (int i = 0; i < options.numGames; ++i) {
+    const auto &result = results[i];
+
+    if (options.verbose)
+      std::cout << "game " << i << " seed=" << options.seed + i <<
+                   " score=" << result.score1 << "/" << result.score2 <<
+                   " turns=" << result.turns << " nodes=" << result.nodes <<
+                   " time=" << result.time*1000.0 << "ms\n";
+
+    totalScore1 += result.score1;
+    totalScore2 += result.score2;
+    totalTurns  += result.turns;
+    totalMoves  += result.moves;
+    totalNodes  += result.nodes;
+  }
+
+  auto perSec  = [&](double n) { return (time > 0.0 ? n/time : 0.0); };
+  auto perGame = [&](double n) { return (options.numGames > 0 ? n/options.numGames : 0.0); };
+
+  std::cout << std::fixed << std::setprecision(2);
+
+  std::cout << "games="      << options.numGames << " threads=" << options.numThreads <<
+               " seed="      << options.seed << " time=" << time << "s\n";
+  std::cout << "games/s="    << perSec(options.numGames) <<
+               " turns/s="   << perSec(totalTurns) <<
+               " nodes/s="   << perSec(totalNodes) << "\n";
+  std::cout << "avg score="  << perGame(totalScore1) << "/" << perGame(totalScore2) <<
+               " avg turns=" << perGame(totalTurns) <<
+               " avg moves=" << perGame(totalMoves) <<
+               " avg nodes=" << perGame(totalNodes) << "\n";
+
+  return 0;
+}
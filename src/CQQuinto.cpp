@@ -7,15 +7,19 @@
 #endif
 
 #include <CQPixmapCache.h>
+#include <CQuintoPosition.h>
+#include <CQuintoSearch.h>
 
 #ifdef USE_HR_TIMER
 #include <CHRTimer.h>
 #endif
 
+#include <QClipboard>
 #include <QToolButton>
 #include <QPushButton>
 #include <QComboBox>
 #include <QMouseEvent>
+#include <QCloseEvent>
 #include <QPainter>
 
 #include <functional>
@@ -35,21 +39,48 @@ main(int argc, char **argv)
   QApplication app(argc, argv);
 #endif
 
-  auto seedRand = true;
+  auto seed       = CQuinto::Random::randomSeed();
+  auto printStats = false;
+  auto numThreads = 1;
+  auto ponder     = true;
+  auto timeLimit  = 0.0;
+  auto nodeLimit  = 0L;
+  auto position   = QString();
 
   for (int i = 1; i < argc; ++i) {
     QString arg = argv[i];
 
-    if (arg == "-noseed")
-      seedRand = false;
+    if      (arg == "-seed" && i < argc - 1)
+      seed = QString(argv[++i]).toULongLong();
+    else if (arg == "-noseed")
+      seed = 0;
+    else if (arg == "-stats")
+      printStats = true;
+    else if (arg == "-threads" && i < argc - 1)
+      numThreads = QString(argv[++i]).toInt();
+    else if (arg == "-noponder")
+      ponder = false;
+    else if (arg == "-time" && i < argc - 1)
+      timeLimit = QString(argv[++i]).toDouble();
+    else if (arg == "-nodes" && i < argc - 1)
+      nodeLimit = QString(argv[++i]).toLong();
+    else if (arg == "-position" && i < argc - 1)
+      position = argv[++i];
   }
 
-  if (seedRand)
-    srand(time(nullptr));
-
   CQQuinto::App quinto;
 
-  quinto.init();
+  quinto.init(seed);
+
+  quinto.game()->board()->setPrintStats      (printStats);
+  quinto.game()->board()->setSearchThreads   (numThreads);
+  quinto.game()->board()->setSearchTimeLimit(timeLimit );
+  quinto.game()->board()->setSearchNodeLimit(nodeLimit );
+
+  quinto.setPonder(ponder);
+
+  if (! position.isEmpty() && ! quinto.setPosition(position))
+    std::cerr << "Invalid position '" << position.toStdString() << "'\n";
 
   quinto.resize(quinto.sizeHint());
 
@@ -74,43 +105,43 @@ App(QWidget *parent) :
 App::
 ~App()
 {
-  delete board_;
-
-  for (auto &turn : turns_)
-    delete turn;
+  // wait for running (cancelled) searches
+  for (auto *search : findChildren<ComputerSearch *>()) {
+    search->cancel();
+    search->wait();
+  }
 
-  delete turn_;
+  delete board_;
 }
 
 void
 App::
-init()
+init(Seed seed)
 {
-  tileSet_ = std::make_unique<TileSet>(this);
+  game_ = std::make_unique<CQuinto::Game>();
 
-  player1_ = std::make_unique<Player>(this, TileOwner::PLAYER1, "Player"  , PlayerType::HUMAN   );
-  player2_ = std::make_unique<Player>(this, TileOwner::PLAYER2, "Computer", PlayerType::COMPUTER);
-
-  currentPlayerOwner_ = TileOwner::PLAYER1;
+  game_->init(seed);
 
   board_ = new Board(this);
 
-  turn_ = new Turn(this, 0);
-
   //---
 
   createWidgets();
 
   //---
 
-  player1_->drawTiles();
-  player2_->drawTiles();
-
-  //---
+  updateTitle();
 
   updateState();
 }
 
+Seed
+App::
+seed() const
+{
+  return game_->seed();
+}
+
 void
 App::
 createWidgets()
@@ -182,46 +213,57 @@ resizeEvent(QResizeEvent *)
   updateWidgets();
 }
 
+void
+App::
+closeEvent(QCloseEvent *e)
+{
+  cancelComputerMove();
+
+  QFrame::closeEvent(e);
+}
+
 void
 App::
 setPlayMode(PlayMode mode)
 {
   if (mode != playMode_) {
+    cancelComputerMove();
+
     playMode_ = mode;
 
     if      (mode == PlayMode::HUMAN_COMPUTER) {
-      player1_->setName("Player"  );
-      player2_->setName("Computer");
+      player1()->setName("Player"  );
+      player2()->setName("Computer");
 
-      player1_->setType(PlayerType::HUMAN);
-      player2_->setType(PlayerType::COMPUTER);
+      player1()->setType(PlayerType::HUMAN);
+      player2()->setType(PlayerType::COMPUTER);
     }
     else if (mode == PlayMode::COMPUTER_HUMAN) {
-      player1_->setName("Computer");
-      player2_->setName("Player"  );
+      player1()->setName("Computer");
+      player2()->setName("Player"  );
 
-      player1_->setType(PlayerType::COMPUTER);
-      player2_->setType(PlayerType::HUMAN);
+      player1()->setType(PlayerType::COMPUTER);
+      player2()->setType(PlayerType::HUMAN);
     }
     else if (mode == PlayMode::HUMAN_HUMAN) {
-      player1_->setName("Player1");
-      player2_->setName("Player2");
+      player1()->setName("Player1");
+      player2()->setName("Player2");
 
-      player1_->setType(PlayerType::HUMAN);
-      player2_->setType(PlayerType::HUMAN);
+      player1()->setType(PlayerType::HUMAN);
+      player2()->setType(PlayerType::HUMAN);
     }
     else if (mode == PlayMode::COMPUTER_COMPUTER) {
-      player1_->setName("Computer1");
-      player2_->setName("Computer2");
+      player1()->setName("Computer1");
+      player2()->setName("Computer2");
 
-      player1_->setType(PlayerType::COMPUTER);
-      player2_->setType(PlayerType::COMPUTER);
+      player1()->setType(PlayerType::COMPUTER);
+      player2()->setType(PlayerType::COMPUTER);
     }
     else {
       assert(false);
     }
 
-    newGame();
+    newGame(CQuinto::Random::randomSeed());
   }
 }
 
@@ -378,13 +420,21 @@ updateWidgets()
 
   auto validScore = isTurnValid();
 
-  bool canUndo = ! turn_->moves().empty();
+  bool canUndo = ! turn()->moves().empty();
 
   cancelButton_->setEnabled(canUndo);
   backButton_  ->setEnabled(canUndo);
   applyButton_ ->setEnabled(validScore.valid);
 }
 
+void
+App::
+updateTitle()
+{
+  // show seed so game can be replayed (-seed <n>)
+  setWindowTitle(QString("CQQuinto (seed %1)").arg(seed()));
+}
+
 //------
 
 void
@@ -398,15 +448,10 @@ void
 App::
 cancel()
 {
-  int n = turn_->moves().size();
-
-  for (int i = n - 1; i >= 0; --i) {
-    auto move = turn_->move(i);
-
-    undoMove(move);
-  }
+  if (isComputerSearching())
+    return;
 
-  turn_->clear();
+  game_->cancel();
 
   //---
 
@@ -426,19 +471,19 @@ void
 App::
 back()
 {
-  int n = turn_->moves().size();
-
-  if (n > 0) {
-    auto move = turn_->move(n - 1);
+  if (isComputerSearching())
+    return;
 
-    undoMove(move);
+  // ponder search is for board before back
+  cancelPonder();
 
-    turn_->popMove();
-  }
+  game_->back();
 
   //---
 
   updateState();
+
+  startPonder();
 }
 
 //------
@@ -447,6 +492,9 @@ void
 App::
 applySlot()
 {
+  if (isComputerSearching())
+    return;
+
   assert(currentPlayer()->type() == PlayerType::HUMAN);
 
   apply();
@@ -456,24 +504,10 @@ void
 App::
 apply(bool next)
 {
-  // check valid
-  auto validScore = isTurnValid();
-
-  if (! validScore.valid)
+  // score turn, draw new tiles and move to next player
+  if (! game_->apply())
     return;
 
-  assert((validScore.score % 5) == 0);
-
-  // update score
-  currentPlayer()->addScore(validScore.score);
-
-  // get new tiles
-  currentPlayer()->drawTiles();
-
-  //---
-
-  nextTurn();
-
   //---
 
   updateState();
@@ -488,115 +522,241 @@ void
 App::
 computerMove()
 {
-  if (isGameOver())
+  if (isGameOver() || isComputerSearching())
     return;
 
-  while (currentPlayer()->type() == PlayerType::COMPUTER) {
-    auto currentPlayerOwner = this->currentPlayerOwner();
-
-    while (currentPlayer()->owner() == currentPlayerOwner && currentPlayer()->canMove()) {
-      // auto play computers best move
-      playComputerMove();
+  // ponder computer reply while human is on turn
+  if (currentPlayer()->type() != PlayerType::COMPUTER) {
+    startPonder();
+    return;
+  }
 
-      // if other player can move computer is done
-      if (currentPlayer()->canMove())
-        break;
+  // if computer can't move then skip to other player (game over if other
+  // player can't move)
+  if (! currentPlayer()->canMove()) {
+    cancelPonder();
 
-      // skip other player
-      nextTurn();
+    game_->nextTurn();
 
-      assert(currentPlayer()->owner() == currentPlayerOwner);
+    if (! currentPlayer()->canMove()) {
+      setGameOver(true);
+      return;
     }
 
-    // if computer can't move then check if game over
-    if (currentPlayer()->owner() == currentPlayerOwner) {
-      nextTurn();
+    updateState();
 
-      // if other player can't move then game over
-      if (! currentPlayer()->canMove()) {
-        setGameOver(true);
-        break;
-      }
+    // other player may be computer
+    computerMove();
+
+    return;
+  }
+
+  // use ponder search if it predicted the current board (played now if
+  // complete, otherwise when it completes)
+  auto *ponderSearch = ponderSearch_;
+
+  ponderSearch_ = nullptr;
+
+  if (ponderSearch) {
+    if (ponderSearch->isPonderMatch(*game_->board(), *currentPlayer(), turn()->ind())) {
+      computerSearch_ = ponderSearch;
+
+      if (computerSearch_->isDone())
+        playComputerSearch();
+      else
+        updateState();
+
+      return;
     }
+
+    releaseSearch(ponderSearch);
   }
-}
 
-//------
+  // search best move in background (GUI stays responsive), played by
+  // computerSearchSlot when search completes
+  computerSearch_ = new ComputerSearch(this);
+
+  connect(computerSearch_, SIGNAL(searchDone()), this, SLOT(computerSearchSlot()),
+          Qt::QueuedConnection);
+
+  computerSearch_->start();
+
+  updateState();
+}
 
 void
 App::
-newGameSlot()
+computerSearchSlot()
 {
-  newGame();
+  // ignore result of ponder search (used on computer turn) or cancelled
+  // (stale) search. Only compare sender as stale search may be deleted
+  if (! computerSearch_ || sender() != computerSearch_)
+    return;
+
+  playComputerSearch();
 }
 
 void
 App::
-newGame()
+playComputerSearch()
 {
-  const int handSize = this->handSize();
+  auto *search = computerSearch_;
 
-  // move all board and player tiles back to tile set
-  for (int i = 0; i < handSize; ++i) {
-    auto tile1 = player1_->takeTile(i, /*nocheck*/true);
-    auto tile2 = player2_->takeTile(i, /*nocheck*/true);
+  computerSearch_ = nullptr;
 
-    if (tile1) tileSet_->ungetTile(tile1);
-    if (tile2) tileSet_->ungetTile(tile2);
-  }
+  // auto play computers best move
+  game_->board()->setBestMove(search->bestMove(), search->stats());
 
-  const int nx = this->nx();
-  const int ny = this->ny();
+  releaseSearch(search);
 
-  for (int iy = 0; iy < ny; ++iy) {
-    for (int ix = 0; ix < nx; ++ix) {
-      TilePosition pos(ix, iy);
+  playComputerMove();
 
-      if (board_->cellTile(pos)) {
-        auto tile = board_->takeCellTile(pos);
+  // if other player can't move then skip back to computer
+  if (! isGameOver() && ! currentPlayer()->canMove()) {
+    cancelPonder();
 
-        if (tile) tileSet_->ungetTile(tile);
-      }
-    }
+    game_->nextTurn();
   }
 
-  //---
+  computerMove();
+}
+
+void
+App::
+cancelComputerMove()
+{
+  if (computerSearch_) {
+    releaseSearch(computerSearch_);
 
-  // reset current player and player scores
-  currentPlayerOwner_ = TileOwner::PLAYER1;
+    computerSearch_ = nullptr;
+  }
 
-  player1_->setScore(0);
-  player2_->setScore(0);
+  cancelPonder();
+}
 
-  player1_->setCanMove(true);
-  player2_->setCanMove(true);
+void
+App::
+setPonder(bool b)
+{
+  ponder_ = b;
 
-  //---
+  if (ponder_)
+    startPonder();
+  else
+    cancelPonder();
+}
 
-  // reset turns
-  for (auto &turn : turns_)
-    delete turn;
+void
+App::
+startPonder()
+{
+  if (! ponder_ || ponderSearch_ || isGameOver())
+    return;
+
+  // only for human turn against computer and before any tiles are placed
+  auto otherOwner =
+    (currentPlayerOwner() == TileOwner::PLAYER1 ? TileOwner::PLAYER2 : TileOwner::PLAYER1);
+
+  if (currentPlayer()->type() != PlayerType::HUMAN ||
+      ownerPlayer(otherOwner)->type() != PlayerType::COMPUTER)
+    return;
+
+  if (! currentPlayer()->canMove() || game_->board()->numTurnCells() > 0)
+    return;
+
+  ponderSearch_ = new ComputerSearch(this, ComputerSearch::Mode::PONDER);
+
+  connect(ponderSearch_, SIGNAL(searchDone()), this, SLOT(computerSearchSlot()),
+          Qt::QueuedConnection);
+
+  ponderSearch_->start();
+}
+
+void
+App::
+cancelPonder()
+{
+  // stale ponder search (turn changed) must not hold a thread or stop a new
+  // ponder search starting
+  if (ponderSearch_) {
+    releaseSearch(ponderSearch_);
+
+    ponderSearch_ = nullptr;
+  }
+}
+
+void
+App::
+releaseSearch(ComputerSearch *search)
+{
+  // cancel and delete when thread finished (deleteLater can be called more
+  // than once)
+  search->cancel();
 
-  turns_.clear();
+  connect(search, SIGNAL(finished()), search, SLOT(deleteLater()));
+
+  if (search->isFinished())
+    search->deleteLater();
+}
+
+//------
+
+void
+App::
+newGameSlot()
+{
+  newGame(CQuinto::Random::randomSeed());
+}
 
-  delete turn_;
+void
+App::
+newGame(Seed seed)
+{
+  cancelComputerMove();
 
-  turn_ = new Turn(this, 0);
+  // reset board, players and turns and deal new tiles
+  game_->newGame(seed);
 
   //---
 
-  // shuffle tiles
-  tileSet_->shuffle();
+  updateTitle();
+
+  newGameButton_->setText("New Game");
 
   //---
 
-  // redraw player tiles
-  player1_->drawTiles();
-  player2_->drawTiles();
+  updateState();
 
   //---
 
-  gameOver_ = false;
+  computerMove();
+}
+
+QString
+App::
+position() const
+{
+  CQuinto::Position position;
+
+  game_->getPosition(position);
+
+  return QString::fromStdString(position.toString());
+}
+
+bool
+App::
+setPosition(const QString &str)
+{
+  CQuinto::Position position;
+
+  if (! position.parse(str.toStdString()))
+    return false;
+
+  cancelComputerMove();
+
+  game_->setPosition(position);
+
+  //---
 
   newGameButton_->setText("New Game");
 
@@ -607,6 +767,8 @@ newGame()
   //---
 
   computerMove();
+
+  return true;
 }
 
 //------
@@ -643,44 +805,15 @@ playComputerMove()
 #endif
 
   updateWidgets();
-
-  qApp->processEvents();
-}
-
-void
-App::
-nextTurn()
-{
-  // next turn
-  turns_.push_back(turn_);
-
-  auto ind = turn_->ind() + 1;
-
-  turn_ = new Turn(this, ind);
-
-  //---
-
-  // switch to next player
-  currentPlayerOwner_ =
-    (currentPlayerOwner_ == TileOwner::PLAYER1 ? TileOwner::PLAYER2 : TileOwner::PLAYER1);
-
-  //---
-
-  board_->invalidateDetails();
-  board_->invalidateBestMove();
-
-  //---
-
-  currentPlayer()->setCanMove(canMove());
 }
 
 void
 App::
 setGameOver(bool b)
 {
-  gameOver_ = b;
+  game_->setGameOver(b);
 
-  if (gameOver_)
+  if (isGameOver())
     newGameButton_->setText("Game Over");
   else
     newGameButton_->setText("New Game");
@@ -688,131 +821,25 @@ setGameOver(bool b)
   updateState();
 }
 
-bool
-App::
-canMove() const
-{
-#ifdef USE_HR_TIMER
-  //CScopeTimer timer("App::canMove");
-#endif
-
-  if (currentPlayer()->numTiles() == 0)
-    return false;
-
-  auto details = board_->boardDetails();
-
-  if (! details.valid)
-    return false;
-
-  if (details.validPositions.empty())
-    return false;
-
-  const BestMove &bestMove = board_->getBestMove();
-
-  if (! bestMove.isValid())
-    return false;
-
-  return true;
-}
-
 ValidScore
 App::
 isTurnValid() const
 {
-  auto details = board_->boardDetails();
-
-  ValidScore validScore;
-
-  validScore.valid = details.valid && ! details.partial;
-  validScore.score = details.score;
-
-  return validScore;
-}
-
-void
-App::
-undoMove(const Move &move)
-{
-  doMoveParts(move.to(), move.from());
+  return game_->isTurnValid();
 }
 
 void
 App::
 doMove(const Move &move)
 {
-  doMoveParts(move.from(), move.to());
-}
-
-void
-App::
-doMoveParts(const TileData &from, const TileData &to)
-{
-  if      (from.owner == TileOwner::PLAYER1) {
-    assert(to.owner == TileOwner::BOARD);
-
-    auto fromTile = player1_->takeTile(from.pos.ix);
-    assert(fromTile);
-
-    fromTile->setPlayer(from.owner);
-    fromTile->setTurn  (turn()->ind());
-
-    board_->setCellTile(to.pos, fromTile);
-  }
-  else if (from.owner == TileOwner::PLAYER2) {
-    assert(to.owner == TileOwner::BOARD);
-
-    auto fromTile = player2_->takeTile(from.pos.ix);
-    assert(fromTile);
-
-    fromTile->setPlayer(from.owner);
-    fromTile->setTurn  (turn()->ind());
-
-    board_->setCellTile(to.pos, fromTile);
-  }
-  else if (from.owner == TileOwner::BOARD) {
-    if      (to.owner == TileOwner::PLAYER1 ||
-             to.owner == TileOwner::PLAYER2) {
-      auto fromTile = board_->takeCellTile(from.pos);
-      assert(fromTile);
-
-      if (to.owner == TileOwner::PLAYER1)
-        player1_->addTile(fromTile, to.pos.ix);
-      else
-        player2_->addTile(fromTile, to.pos.ix);
-    }
-    else if (to.owner == TileOwner::BOARD) {
-      auto fromCell = board_->takeCellTile(from.pos);
-      assert(fromCell);
-
-      board_->setCellTile(to.pos, fromCell);
-    }
-  }
-  else {
-    assert(false);
-  }
-}
-
-int
-App::
-moveScore(const Move &move) const
-{
-  auto to = move.to();
-
-  if (to.owner == TileOwner::BOARD) {
-    auto tile = board_->cellTile(to.pos);
-
-    if (tile)
-      return tile->value();
-  }
-
-  return 0;
+  game_->doMove(move);
 }
 
 void
 App::
 addMove(const Move &move)
 {
-  turn_->addMove(move);
+  game_->addMove(move);
 }
 
 double
@@ -838,126 +865,106 @@ sizeHint() const
 
 //---
 
-TileData::
-TileData(TileOwner owner, const TilePosition &pos) :
- owner(owner), pos(pos)
-{
-}
-
-void
-TileData::
-print(std::ostream &os) const
+ComputerSearch::
+ComputerSearch(App *quinto, Mode mode) :
+ QThread(quinto), mode_(mode)
 {
-  if      (owner == TileOwner::PLAYER1 ) { os << "Player1:" << pos.ix; }
-  else if (owner == TileOwner::PLAYER2 ) { os << "Player2:" << pos.ix; }
-  else if (owner == TileOwner::BOARD   ) { os << "Board:" << pos.ix << "," << pos.iy; }
-  else if (owner == TileOwner::TILE_SET) { os << "TileSet:"; }
-}
+  setObjectName("computerSearch");
 
-//---
+  // copy current board and player hand (game can change while searching)
+  const auto &board = quinto->game()->board();
 
-template<typename FN, typename... ARGS>
-auto curry(FN fn, ARGS... args) {
-  return [=](auto... rest) { return fn(args..., rest...); };
-}
+  search_ = std::make_unique<CQuinto::Search>();
 
-template<typename FN>
-auto repeatFn(int n, FN fn) {
-  for (int i = 0; i < n; ++i)
-    fn();
-}
+  if (mode_ == Mode::PONDER) {
+    // human (current player) best move search
+    ponderSearch_ = std::make_unique<CQuinto::Search>();
 
-TileSet::
-TileSet(App *quinto) :
- quinto_(quinto)
-{
-  auto addTile = [&](int value) {
-    auto ind = tiles_.size();
+    board->initSearch(*ponderSearch_);
 
-    auto tile = new Tile(quinto_, ind, value);
+    ponderSearch_->setCancel(&cancel_);
 
-    tile->setOwner (TileOwner::TILE_SET);
-    tile->setPlayer(TileOwner::NONE);
+    // computer reply search for next turn (human move added when found)
+    owner_ = (quinto->currentPlayerOwner() == TileOwner::PLAYER1 ?
+              TileOwner::PLAYER2 : TileOwner::PLAYER1);
+    turn_  = quinto->turn()->ind() + 1;
+  }
+  else {
+    owner_ = quinto->currentPlayerOwner();
+    turn_  = quinto->turn()->ind();
+  }
 
-    tiles_.push_back(tile);
+  const auto &player = quinto->ownerPlayer(owner_);
 
-    itiles_.push_back(tile);
-  };
+  hand_ = player->tiles();
 
-  /* 7  - #0 Tiles */ repeatFn( 7, curry(addTile, 0));
-  /* 6  - #1 Tiles */ repeatFn( 6, curry(addTile, 1));
-  /* 6  - #2 Tiles */ repeatFn( 6, curry(addTile, 2));
-  /* 7  - #3 Tiles */ repeatFn( 7, curry(addTile, 3));
-  /* 10 - #4 Tiles */ repeatFn(10, curry(addTile, 4));
-  /* 6  - #5 Tiles */ repeatFn( 6, curry(addTile, 5));
-  /* 10 - #6 Tiles */ repeatFn(10, curry(addTile, 6));
-  /* 14 - #7 Tiles */ repeatFn(14, curry(addTile, 7));
-  /* 12 - #8 Tiles */ repeatFn(12, curry(addTile, 8));
-  /* 12 - #9 Tiles */ repeatFn(12, curry(addTile, 9));
+  board->initSearch(*search_, *player, turn_);
 
-  shuffle();
+  search_->setCancel(&cancel_);
 }
 
-TileSet::
-~TileSet()
+ComputerSearch::
+~ComputerSearch()
 {
-  for (auto &tile : itiles_)
-    delete tile;
 }
 
-void
-TileSet::
-shuffle()
+const CQuinto::SearchStats &
+ComputerSearch::
+stats() const
 {
-  auto nt = tiles_.size();
-
-  auto ns = 100;
-
-  for (auto i = 0; i < ns; ++i) {
-    auto pos1 = rand() % nt;
-    auto pos2 = rand() % nt;
-
-    while (pos1 == pos2)
-      pos2 = rand() % nt;
-
-    std::swap(tiles_[pos1], tiles_[pos2]);
-  }
+  return search_->stats();
 }
 
-Tile *
-TileSet::
-getTile()
+bool
+ComputerSearch::
+isPonderMatch(const CQuinto::Board &board, const CQuinto::Player &player, int turn) const
 {
-  if (tiles_.empty())
-    return nullptr;
-
-  auto tile = tiles_.back();
-
-  tile->setOwner (TileOwner::NONE);
-  tile->setPlayer(TileOwner::NONE);
+  if (mode_ != Mode::PONDER || ! predicted_ || isCancelled())
+    return false;
 
-  tiles_.pop_back();
+  if (player.owner() != owner_ || turn != turn_ || player.tiles() != hand_)
+    return false;
 
-  return tile;
+  return (board.numTurnCells() == 0 && board.bits().sameValues(ponderBits_));
 }
 
 void
-TileSet::
-ungetTile(Tile *tile)
+ComputerSearch::
+run()
 {
-  tile->setOwner (TileOwner::TILE_SET);
-  tile->setPlayer(TileOwner::NONE);
+  if (mode_ == Mode::PONDER) {
+    // assume human plays best move
+    BestMove humanMove;
 
-  tiles_.push_back(tile);
-}
+    ponderSearch_->calcBestMove(humanMove);
+
+    if (isCancelled() || ! humanMove.isValid())
+      return;
+
+    search_->commitMove(*ponderSearch_, humanMove);
+
+    ponderBits_ = search_->state().bits();
+
+    predicted_ = true;
+  }
+
+  search_->calcBestMove(bestMove_);
+
+  if (isCancelled())
+    return;
+
+  done_ = true;
+
+  emit searchDone();
+}
 
 //---
 
 Tile::
-Tile(App *quinto, int ind, int value) :
- quinto_(quinto), ind_(ind), value_(value)
+Tile(App *quinto) :
+ QWidget(quinto), quinto_(quinto)
 {
-  setObjectName(QString("tile.%1").arg(ind_));
+  setObjectName("tile");
 
   setWindowFlags(Qt::Tool | Qt::FramelessWindowHint | Qt::X11BypassWindowManagerHint);
 
@@ -1018,31 +1025,28 @@ drawTile(QPainter *painter)
 
   painter->setPen(fg);
 
-  drawTile(painter, rect());
+  drawTile(painter, rect(), value(), font_, fg);
 }
 
 void
 Tile::
-drawTile(QPainter *painter, const QRectF &rect)
+drawTile(QPainter *painter, const QRectF &rect, int value,
+         const QFont &font, const QColor &borderColor)
 {
   QColor textColor = painter->pen().color();
 
   //---
 
-  QColor fg = quinto_->tileBorderColor();
-
-  painter->setPen(fg);
+  painter->setPen(borderColor);
 
   painter->drawRect(rect);
 
   //---
 
-  painter->setFont(font_);
+  painter->setFont(font);
 
   QFontMetricsF fm(painter->font());
 
-  auto value = this->value();
-
   QString text = QString("%1").arg(value);
 
   double tx = rect.center().x() - fm.horizontalAdvance(text)/2.0;
@@ -1055,102 +1059,6 @@ drawTile(QPainter *painter, const QRectF &rect)
 
 //---
 
-Player::
-Player(App *quinto, TileOwner owner, const QString &name, PlayerType type) :
- quinto_(quinto), owner_(owner), name_(name), type_(type)
-{
-  const int handSize = quinto_->handSize();
-
-  for (int i = 0; i < handSize; ++i)
-    tiles_.push_back(nullptr);
-}
-
-int
-Player::
-numTiles() const
-{
-  const int handSize = quinto_->handSize();
-
-  auto n = 0;
-
-  for (int i = 0; i < handSize; ++i)
-    if (tiles_[i])
-      ++n;
-
-  return n;
-}
-
-void
-Player::
-drawTiles()
-{
-  int nt = tiles_.size();
-
-  for (int i = 0; i < nt; ++i) {
-    if (tiles_[i])
-      continue;
-
-    auto tile = quinto_->tileSet()->getTile();
-
-    if (! tile)
-      break;
-
-    tile->setOwner (owner());
-    tile->setPlayer(TileOwner::NONE);
-
-    tiles_[i] = tile;
-  }
-}
-
-Tile *
-Player::
-tile(int i) const
-{
-  //assert(i >= 0 && i < quinto_->handSize());
-
-  return tiles_[i];
-}
-
-Tile *
-Player::
-takeTile(int i, bool nocheck)
-{
-  //assert(i >= 0 && i < quinto_->handSize());
-
-  auto tile = tiles_[i];
-
-  if (nocheck) {
-    if (! tile)
-      return nullptr;
-  }
-  else {
-    assert(tile);
-  }
-
-  tile->setOwner (TileOwner::NONE);
-  tile->setPlayer(TileOwner::NONE);
-
-  tiles_[i] = nullptr;
-
-  return tile;
-}
-
-void
-Player::
-addTile(Tile *tile, int i)
-{
-  //assert(i >= 0 && i < quinto_->handSize());
-
-  //assert(! tiles_[i]);
-
-  tiles_[i] = tile;
-
-  tile->setOwner (owner());
-  tile->setPlayer(TileOwner::NONE);
-}
-
-//---
-
 Board::
 Board(App *quinto) :
  QWidget(quinto), quinto_(quinto)
@@ -1159,64 +1067,7 @@ Board(App *quinto) :
 
   setFocusPolicy(Qt::StrongFocus);
 
-  const int nx = quinto_->nx();
-  const int ny = quinto_->ny();
-
-  tiles_.resize(ny);
-
-  for (int iy = 0; iy < ny; ++iy) {
-    tiles_[iy].resize(nx);
-
-    for (int ix = 0; ix < nx; ++ix)
-      tiles_[iy][ix] = nullptr;
-  }
-}
-
-#if 0
-Tile *
-Board::
-cellTile(const TilePosition &pos) const
-{
-  assert(validPos(pos));
-
-  return tiles_[pos.iy][pos.ix];
-}
-#endif
-
-Tile *
-Board::
-takeCellTile(const TilePosition &pos)
-{
-  //assert(validPos(pos));
-
-  auto tile = tiles_[pos.iy][pos.ix];
-  assert(tile);
-
-  tiles_[pos.iy][pos.ix] = nullptr;
-
-  tile->setOwner (TileOwner::NONE);
-  tile->setPlayer(TileOwner::NONE);
-
-  invalidateDetails();
-  invalidateBestMove();
-
-  return tile;
-}
-
-void
-Board::
-setCellTile(const TilePosition &pos, Tile *tile)
-{
-  //assert(validPos(pos));
-
-  assert(! tiles_[pos.iy][pos.ix]);
-
-  tile->setOwner(TileOwner::BOARD);
-
-  tiles_[pos.iy][pos.ix] = tile;
-
-  invalidateDetails();
-  invalidateBestMove();
+  dragTile_ = new Tile(quinto_);
 }
 
 void
@@ -1291,7 +1142,7 @@ drawBoard(QPainter *painter)
 
   //----
 
-  auto details = boardDetails();
+  const auto &details = gameBoard()->boardDetails();
 
   //----
 
@@ -1304,15 +1155,15 @@ drawBoard(QPainter *painter)
 
       QRectF rect(pos_.x() + ix*ts, pos_.y() + iy*ts, ts, ts);
 
-      auto tile = this->cellTile(pos);
+      const auto &cell = gameBoard()->cell(pos);
 
-      bool current = (tile && tile->turn() == turnInd);
-      bool valid   = (details.validPositions.find(pos) != details.validPositions.end());
+      bool current = (cell.isSet() && cell.turn == turnInd);
+      bool valid   = details.validPositions.contains(pos);
 
       QColor bgColor;
       QColor fgColor = quinto_->tileBorderColor();
 
-      if (tile) {
+      if (cell.isSet()) {
         bgColor = quinto_->tileBgColor();
 
         if (current) {
@@ -1322,7 +1173,7 @@ drawBoard(QPainter *painter)
             fgColor = quinto_->currentTileColor();
         }
         else {
-          if (tile->player() == TileOwner::PLAYER1)
+          if (cell.player == TileOwner::PLAYER1)
             fgColor = quinto_->player1TileColor();
           else
             fgColor = quinto_->player2TileColor();
@@ -1337,13 +1188,16 @@ drawBoard(QPainter *painter)
         fgColor = Qt::black;
       }
 
-      drawTile(painter, tile, rect, ts, bgColor, fgColor);
+      drawTile(painter, cell.value, rect, ts, bgColor, fgColor);
     }
   }
 
   //---
 
   drawScores(painter);
+
+  if (showStats_)
+    drawStats(painter);
 }
 
 void
@@ -1365,6 +1219,9 @@ drawTurn(QPainter *painter)
 
   QString turnText = QString("Turn: %1").arg(quinto_->turn()->ind() + 1);
 
+  if (! message_.isEmpty())
+    turnText += "  " + message_;
+
   auto dbt = playerTileSize() - fm.height();
 
   double x = b;
@@ -1405,23 +1262,25 @@ drawScores(QPainter *painter)
   QString score1Text = QString("%1").arg(p1score);
   QString score2Text = QString("%1").arg(p2score);
 
-  if (details_.valid) {
+  const auto &details = gameBoard()->boardDetails();
+
+  if (details.valid) {
     const PlayerP &currentPlayer = quinto_->currentPlayer();
 
     if (currentPlayer == player1) {
-      p1extra = details_.score;
+      p1extra = details.score;
 
       score1Text += QString(" (%1)").arg(p1extra);
     }
     else {
-      p2extra = details_.score;
+      p2extra = details.score;
 
       score2Text += QString(" (%1)").arg(p2extra);
     }
   }
 
-  QString p1Title = QString("%1: ").arg(player1->name());
-  QString p2Title = QString("%1: ").arg(player2->name());
+  QString p1Title = QString("%1: ").arg(QString::fromStdString(player1->name()));
+  QString p2Title = QString("%1: ").arg(QString::fromStdString(player2->name()));
 
   auto sy = height() - 1 - fm.descent() - 2;
 
@@ -1444,6 +1303,52 @@ drawScores(QPainter *painter)
   painter->drawText(sx2, sy, p2Title);
 }
 
+void
+Board::
+drawStats(QPainter *painter)
+{
+  const int b = 4;
+
+  const auto &stats = gameBoard()->searchStats();
+
+  QStringList lines;
+
+  lines << QString("Nodes: %1"     ).arg(stats.nodes);
+  lines << QString("Leaves: %1"    ).arg(stats.leaves);
+  lines << QString("Depth: %1"     ).arg(stats.maxDepth);
+  lines << QString("Pruned: %1"    ).arg(stats.pruned);
+  lines << QString("Duplicates: %1").arg(stats.duplicates);
+  lines << QString("Bounded: %1"   ).arg(stats.bounded);
+  lines << QString("Time: %1ms"    ).arg(stats.time*1000.0, 0, 'f', 3);
+  lines << QString("Nodes/s: %1"   ).arg(int(stats.nodesPerSec()));
+
+  // draw in top left of board over semi-transparent background
+  QFont font;
+
+  painter->setFont(font);
+
+  QFontMetricsF fm(painter->font());
+
+  double tw = 0;
+
+  for (const auto &line : lines)
+    tw = std::max(tw, fm.horizontalAdvance(line));
+
+  QRectF rect(pos_.x() + b, pos_.y() + b, tw + 2*b, lines.size()*fm.height() + 2*b);
+
+  painter->fillRect(rect, QColor(255, 255, 255, 200));
+
+  painter->setPen(Qt::black);
+
+  double y = rect.top() + b + fm.ascent();
+
+  for (const auto &line : lines) {
+    painter->drawText(QPointF(rect.left() + b, y), line);
+
+    y += fm.height();
+  }
+}
+
 void
 Board::
 drawPlayerTiles(QPainter *painter, const PlayerP &player, int x, Qt::Alignment align)
@@ -1468,7 +1373,7 @@ drawPlayerTiles(QPainter *painter, const PlayerP &player, int x, Qt::Alignment a
   //---
 
   // calc name and tile position
-  QString playerText = player->name();
+  QString playerText = QString::fromStdString(player->name());
 
   int tx, px;
 
@@ -1487,8 +1392,10 @@ drawPlayerTiles(QPainter *painter, const PlayerP &player, int x, Qt::Alignment a
 
   auto ty = b;
 
-  player->setTileX(px);
-  player->setTileY(ty);
+  if (player->owner() == TileOwner::PLAYER1)
+    player1TilePos_ = QPoint(px, ty);
+  else
+    player2TilePos_ = QPoint(px, ty);
 
   //---
 
@@ -1505,7 +1412,7 @@ drawPlayerTiles(QPainter *painter, const PlayerP &player, int x, Qt::Alignment a
 
   auto dbt = playerTileSize() - fm.height();
 
-  painter->drawText(tx, player->tileY() + dbt/2 + fm.ascent(), playerText);
+  painter->drawText(tx, ty + dbt/2 + fm.ascent(), playerText);
 
   //---
 
@@ -1521,26 +1428,26 @@ drawPlayerTiles(QPainter *painter, const PlayerP &player, int x, Qt::Alignment a
   for (int i = 0; i < handSize; ++i) {
     double x = px + i*playerTileSize();
 
-    QRectF rect(x, player->tileY(), playerTileSize(), playerTileSize());
+    QRectF rect(x, ty, playerTileSize(), playerTileSize());
 
-    auto tile = player->tile(i);
-
-    drawTile(painter, tile, rect, playerTileSize(), bgColor, fgColor);
+    drawTile(painter, player->tile(i), rect, playerTileSize(), bgColor, fgColor);
   }
 }
 
 void
 Board::
-drawTile(QPainter *painter, Tile *tile, const QRectF &rect, double s,
+drawTile(QPainter *painter, int value, const QRectF &rect, double s,
          const QColor &bgColor, const QColor &fgColor)
 {
   painter->setBrush(bgColor);
   painter->setPen  (fgColor);
 
-  if (tile) {
-    tile->setSize(s);
+  if (value >= 0) {
+    QFont font;
+
+    font.setPointSizeF(font.pointSizeF()*quinto_->calcFontScale(s));
 
-    tile->drawTile(painter, rect);
+    Tile::drawTile(painter, rect, value, font, quinto_->tileBorderColor());
   }
   else {
     QColor fg = quinto_->tileBorderColor();
@@ -1555,14 +1462,9 @@ void
 Board::
 playBestMove(bool next)
 {
-  const BestMove &bestMove = getBestMove();
-
-  if (! bestMove.isValid())
+  if (! gameBoard()->playBestMove())
     return; // assert ?
 
-  for (const auto &move : bestMove.moves)
-    quinto_->doMove(move);
-
   quinto_->apply(next);
 }
 
@@ -1570,817 +1472,190 @@ void
 Board::
 showBestMove() const
 {
-  const BestMove &bestMove = getBestMove();
+  gameBoard()->showBestMove();
+}
 
-  if (! bestMove.isValid())
-    return; // assert ?
+void
+Board::
+mousePressEvent(QMouseEvent *e)
+{
+  if (quinto_->isComputerSearching())
+    return;
 
-  std::cerr << "Best Moves:";
+  dragPos_  = e->globalPos();
+  dragging_ = false;
 
-  for (const auto &move : bestMove.moves) {
-    std::cerr << " ";
+  pressData_ = posToTileData(e->pos());
 
-    move.print(std::cerr);
-  }
+  const PlayerP &currentPlayer = quinto_->currentPlayer();
 
-  std::cerr << " @" << bestMove.score << "\n";
-}
+  auto turnInd = quinto_->turn()->ind();
 
-const BestMove &
-Board::
-getBestMove() const
-{
-  if (! bestMoveValid_) {
-    auto th = const_cast<Board *>(this);
+  if     (pressData_.owner == TileOwner::PLAYER1 ||
+          pressData_.owner == TileOwner::PLAYER2) {
+    const PlayerP &pressPlayer = quinto_->ownerPlayer(pressData_.owner);
 
-    th->calcBestMove();
+    if (pressPlayer == currentPlayer && currentPlayer->hasTile(pressData_.pos.ix)) {
+      dragTile_->setValue(currentPlayer->tile(pressData_.pos.ix));
+      dragTile_->setSize (playerTileSize());
 
-    th->bestMoveValid_ = true;
-  }
+      dragging_ = true;
 
-  return bestMove_;
-}
+      QRect rect(dragPos_, QSize(playerTileSize(), playerTileSize()));
 
-void
-Board::
-calcBestMove()
-{
-  bestMove_.reset();
+      dragTile_->show(rect);
+    }
+  }
+  else if (pressData_.owner == TileOwner::BOARD) {
+    TilePosition pressPos = pressData_.pos;
 
-  auto moveTree = boardMoveTree();
+    const auto &cell = gameBoard()->cell(pressPos);
 
-  if (! moveTree)
-    return;
+    if (cell.isSet() && cell.turn == turnInd) {
+      double ts = boardTileSize();
 
-  //std::cerr << "Move Tree: "; moveTree->print(std::cerr); std::cerr << "\n";
+      dragTile_->setValue(cell.value);
+      dragTile_->setSize (ts);
 
-  auto maxLeaf = moveTree->maxLeaf();
+      dragging_ = true;
 
-  if (maxLeaf) {
-    maxLeaf->hierMoves(bestMove_.moves);
+      QRect rect(dragPos_, QSize(ts, ts));
 
-    bestMove_.score = maxLeaf->score;
+      dragTile_->show(rect);
+    }
   }
-
-  //---
-
-  delete moveTree;
 }
 
-MoveTree *
+void
 Board::
-boardMoveTree() const
+mouseMoveEvent(QMouseEvent *e)
 {
-  auto root = new MoveTree;
+  if (! dragging_)
+    return;
+
+  auto dragPos = e->globalPos();
 
-  (void) buildMoveTree(root, 0);
+  dragTile_->move(dragPos);
 
-  return root;
+  dragPos_ = dragPos;
 }
 
-bool
+void
 Board::
-buildMoveTree(MoveTree *tree, int depth) const
+mouseReleaseEvent(QMouseEvent *e)
 {
-  assert(depth <= 5);
-
-  BoardMoves moves;
+  if (! dragging_)
+    return;
 
-  moves.depth = depth;
+  dragging_ = false;
 
-  if (! boardMoves(moves))
-    return false;
+  dragTile_->hide();
 
-  tree->partial = moves.partial;
-  tree->score   = moves.score;
+  releaseData_ = posToTileData(e->pos());
 
-  for (auto &move : moves.moves) {
-    quinto_->doMoveParts(move.from(), move.to());
+  // player -> board
+  if      (pressData_.owner == TileOwner::PLAYER1 ||
+           pressData_.owner == TileOwner::PLAYER2) {
+    if (releaseData_.owner != TileOwner::BOARD)
+      return;
 
-    auto child = new MoveTree;
+    // ensure destination is empty (TODO: only to valid square)
+    if (gameBoard()->hasCell(releaseData_.pos))
+      return;
+  }
+  // board -> player or board
+  else if (pressData_.owner == TileOwner::BOARD) {
+    // board -> player
+    if      (releaseData_.owner == TileOwner::PLAYER1 ||
+             releaseData_.owner == TileOwner::PLAYER2) {
+      const PlayerP &releasePlayer = quinto_->ownerPlayer(releaseData_.owner);
 
-    if (buildMoveTree(child, depth + 1)) {
-      tree->addChild(child);
+      const PlayerP &currentPlayer = quinto_->currentPlayer();
 
-      child->move = move;
-    }
-    else {
-      delete child;
+      if (releasePlayer != currentPlayer)
+        return;
     }
+    else if (releaseData_.owner == TileOwner::BOARD) {
+      assert(gameBoard()->hasCell(pressData_.pos));
 
-    quinto_->doMoveParts(move.to(), move.from());
+      if (gameBoard()->hasCell(releaseData_.pos))
+        return;
+    }
+    else
+      return;
+  }
+  else {
+    return;
   }
-
-std::cerr << tree->root()->size() << std::endl;
-  return true;
-}
-
-bool
-Board::
-boardMoves(BoardMoves &moves) const
-{
-  auto details = boardDetails();
-
-  if (! details.valid)
-    return false;
-
-  //assert(details.npt == moves.depth);
-
-  //---
-
-  moves.score   = details.score;
-  moves.partial = details.partial;
 
   //---
 
-  const int handSize = quinto_->handSize();
+  Move move(pressData_, releaseData_);
 
-  const PlayerP &currentPlayer = quinto_->currentPlayer();
+  quinto_->addMove(move);
 
-  auto playerOwner = currentPlayer->owner();
+  quinto_->doMove(move);
 
-  for (const auto &position : details.validPositions) {
-    using ValueSet = std::set<int>;
+  quinto_->updateState();
+}
 
-    ValueSet values;
+void
+Board::
+keyPressEvent(QKeyEvent *ke)
+{
+  // clear message of previous key
+  if (! message_.isEmpty()) {
+    message_ = "";
 
-    for (int i = 0; i < handSize; ++i) {
-      auto tile = currentPlayer->tile(i);
-      if (! tile) continue;
+    update();
+  }
 
-      auto p = values.find(tile->value());
-      if (p != values.end()) continue;
+  // best move keys use board search (wait for computer move)
+  if (quinto_->isComputerSearching() &&
+      (ke->key() == Qt::Key_B || ke->key() == Qt::Key_P))
+    return;
 
-      TilePosition pos(i, 0);
+  if      (ke->key() == Qt::Key_B)
+    showBestMove();
+  else if (ke->key() == Qt::Key_P)
+    playBestMove();
+  else if (ke->key() == Qt::Key_S) {
+    showStats_ = ! showStats_;
 
-      TileData from(playerOwner, pos);
-      TileData to  (TileOwner::BOARD, position);
+    update();
+  }
+  // copy/paste position notation
+  else if (ke->key() == Qt::Key_C) {
+    auto position = quinto_->position();
 
-      Move move(from, to);
+    QApplication::clipboard()->setText(position);
+  }
+  else if (ke->key() == Qt::Key_V) {
+    if (! quinto_->isComputerSearching()) {
+      auto position = QApplication::clipboard()->text();
 
-      moves.moves.push_back(move);
+      if (! quinto_->setPosition(position)) {
+        message_ = "Invalid Position";
 
-      values.insert(tile->value());
+        update();
+      }
     }
   }
-
-  return true;
 }
 
-const BoardDetails &
+TileData
 Board::
-boardDetails() const
+posToTileData(const QPoint &pos) const
 {
-  if (! detailsValid_) {
-    auto th = const_cast<Board *>(this);
+  TileData tileData;
 
-    th->calcBoardDetails();
+  const int nx = quinto_->nx();
+  const int ny = quinto_->ny();
 
-    th->detailsValid_ = true;
-  }
+  auto x = pos.x();
+  auto y = pos.y();
 
-  return details_;
-}
-
-// depends on cells, current turn
-void
-Board::
-calcBoardDetails()
-{
-  auto addValidPosition = [&](const TilePosition &pos) {
-    //assert(! cellTile(pos));
-
-    details_.addValidPosition(pos);
-  };
-
-  //---
-
-  details_.reset();
-
-  details_.valid   = true;
-  details_.partial = false;
-
-  //---
-
-  auto turnInd = quinto_->turn()->ind();
-
-  const int nx = quinto_->nx();
-  const int ny = quinto_->ny();
-
-  //---
-
-  // count number of current move tiles in each row (y) and column (x) and
-  // save row/columns containing current move tiles
-  BoardLines boardLines;
-
-  details_.nt  = 0;
-  details_.npt = 0;
-
-  for (int iy = 0; iy < ny; ++iy) {
-    for (int ix = 0; ix < nx; ++ix) {
-      TilePosition pos(ix, iy);
-
-      auto tile = cellTile(pos);
-      if (! tile) continue;
-
-      ++details_.nt;
-
-      if (tile->turn() == turnInd) {
-        boardLines.xinds.insert(ix);
-        boardLines.yinds.insert(iy);
-
-        ++details_.npt;
-      }
-    }
-  }
-
-  //---
-
-  // if board empty then must be valid
-  // return center positions for valid positions
-  if (details_.nt == 0) {
-#if 0
-    // multiple center positions
-    auto ix1 = (nx - 1)/2, ix2 = nx/2;
-    auto iy1 = (ny - 1)/2, iy2 = ny/2;
-
-    addValidPosition(TilePosition(ix1, iy1));
-    addValidPosition(TilePosition(ix2, iy1));
-    addValidPosition(TilePosition(ix1, iy2));
-    addValidPosition(TilePosition(ix2, iy2));
-#else
-    // single center position
-    auto ix1 = (nx - 1)/2;
-    auto iy1 = (ny - 1)/2;
-
-    addValidPosition(TilePosition(ix1, iy1));
-#endif
-
-    details_.partial = true;
-
-    return;
-  }
-
-  //----
-
-  // no tiles placed yet (for current player) then must be valid,
-  if (details_.npt == 0) {
-    //assert(boardLines.xinds.empty() && boardLines.yinds.empty());
-
-    // play off existing pieces (board not empty)
-    for (int iy = 0; iy < ny; ++iy) {
-      for (int ix = 0; ix < nx; ++ix) {
-        TilePosition pos(ix, iy);
-
-        auto tile = cellTile(pos);
-        if (tile) continue;
-
-        // check if empty cell has any surrounding tiles
-        TilePosition l_pos = pos.left  ();
-        TilePosition r_pos = pos.right ();
-        TilePosition t_pos = pos.top   ();
-        TilePosition b_pos = pos.bottom();
-
-        auto l_tile = (ix > 0      ? cellTile(l_pos) : nullptr);
-        auto r_tile = (ix < nx - 1 ? cellTile(r_pos) : nullptr);
-        auto t_tile = (iy > 0      ? cellTile(t_pos) : nullptr);
-        auto b_tile = (iy < ny - 1 ? cellTile(b_pos) : nullptr);
-
-        if (! l_tile && ! r_tile && ! t_tile && ! b_tile)
-          continue;
-
-        //---
-
-        // count run to left, right, top, bottom
-        auto l_count = (l_tile ? countTiles(l_pos, Side::LEFT  ) : 0);
-        auto r_count = (r_tile ? countTiles(r_pos, Side::RIGHT ) : 0);
-
-        if (l_count + r_count + 1 > 5)
-          continue;
-
-        auto t_count = (t_tile ? countTiles(t_pos, Side::TOP   ) : 0);
-        auto b_count = (b_tile ? countTiles(b_pos, Side::BOTTOM) : 0);
-
-        if (t_count + b_count + 1 > 5)
-          continue;
-
-        //---
-
-        addValidPosition(pos);
-      }
-    }
-
-    // can't apply yet
-    details_.partial = true;
-
-    return;
-  }
-
-  //---
-
-  // get connected lines, length 2 or more, including at least one turn piece
-  getBoardLines(boardLines);
-
-  //---
-
-  // check all lines
-  for (const auto &line : boardLines.hlines) {
-    LineValid lineValid;
-
-    details_.valid = line.isValid(lineValid);
-
-    details_.partial = lineValid.partial;
-    details_.errMsg  = lineValid.errMsg;
-
-    if (! details_.valid) {
-      //line.print(std::cerr, details_.errMsg); std::cerr << "\n";
-      return;
-    }
-  }
-
-  for (const auto &line : boardLines.vlines) {
-    LineValid lineValid;
-
-    details_.valid = line.isValid(lineValid);
-
-    details_.partial = lineValid.partial;
-    details_.errMsg  = lineValid.errMsg;
-
-    //line.print(std::cerr, details_.errMsg); std::cerr << "\n";
-
-    if (! details_.valid)
-      return;
-  }
-
-  //---
-
-  // single piece played then check row or column
-  if (details_.npt == 1) {
-    //assert(boardLines.xinds.size() == 1 && boardLines.yinds.size() == 1);
-
-    auto ix1 = *boardLines.xinds.begin();
-    auto iy1 = *boardLines.yinds.begin();
-
-    //---
-
-    // play off vertical lines of existing piece (board not empty)
-    for (int iy = 0; iy < ny; ++iy) {
-      TilePosition pos(ix1, iy);
-
-      auto tile = cellTile(pos);
-      if (tile) continue;
-
-      // check if empty cell has any surrounding tiles
-      TilePosition t_pos = pos.top   ();
-      TilePosition b_pos = pos.bottom();
-
-      auto t_tile = (iy > 0      ? cellTile(t_pos) : nullptr);
-      auto b_tile = (iy < ny - 1 ? cellTile(b_pos) : nullptr);
-
-      if (! t_tile && ! b_tile)
-        continue;
-
-      //---
-
-      // count runs at top and bottom
-      auto t_count = (t_tile ? countTiles(t_pos, Side::TOP   ) : 0);
-      auto b_count = (b_tile ? countTiles(b_pos, Side::BOTTOM) : 0);
-
-      if (t_count + b_count + 1 > 5)
-        continue;
-
-      //---
-
-      addValidPosition(pos);
-    }
-
-    //---
-
-    // play off horizontal lines of existing piece (board not empty)
-    for (int ix = 0; ix < nx; ++ix) {
-      TilePosition pos(ix, iy1);
-
-      auto tile = cellTile(pos);
-      if (tile) continue;
-
-      // check if empty cell has any surrounding tiles
-      TilePosition l_pos = pos.left ();
-      TilePosition r_pos = pos.right();
-
-      auto l_tile = (ix > 0      ? cellTile(l_pos) : nullptr);
-      auto r_tile = (ix < nx - 1 ? cellTile(r_pos) : nullptr);
-
-      if (! l_tile && ! r_tile)
-        continue;
-
-      //---
-
-      // count runs to left and right
-      auto l_count = (l_tile ? countTiles(l_pos, Side::LEFT  ) : 0);
-      auto r_count = (r_tile ? countTiles(r_pos, Side::RIGHT ) : 0);
-
-      if (l_count + r_count + 1 > 5)
-        continue;
-
-      //---
-
-      addValidPosition(pos);
-    }
-
-    //---
-
-    //TilePosition pos(ix1, iy1);
-
-    //auto tile = cellTile(pos);
-    //assert(tile);
-
-    details_.valid   = true;
-    details_.score   = boardLines.score();
-    details_.partial = ((details_.score % 5) != 0);
-
-    return;
-  }
-
-  //---
-
-  // two or more pieces. must be in a single row or column
-  if (boardLines.xinds.size() > 1 && boardLines.yinds.size() > 1) {
-    details_.valid  = false;
-    details_.errMsg = "Disjoint pieces";
-    return;
-  }
-
-  //---
-
-  bool horizontal = (boardLines.xinds.size() > 1);
-
-  //---
-
-  TileLines &lines = (horizontal ? boardLines.hlines : boardLines.vlines);
-  //assert(! lines.empty());
-
-  //---
-
-  // score all lines
-  details_.score = boardLines.score();
-
-  //---
-
-  details_.partial = ((details_.score % 5) != 0);
-
-  //---
-
-  // add valid positions (end of lines)
-  for (const auto &line : lines) {
-    if (line.len() >= 5)
-      continue;
-
-    if (horizontal) {
-      auto ix1 = line.start - 1;
-      auto ix2 = line.end   + 1;
-
-      if (ix1 >= 0 ) addValidPosition(TilePosition(ix1, line.pos));
-      if (ix2 <  nx) addValidPosition(TilePosition(ix2, line.pos));
-    }
-    else {
-      auto iy1 = line.start - 1;
-      auto iy2 = line.end   + 1;
-
-      if (iy1 >= 0 ) addValidPosition(TilePosition(line.pos, iy1));
-      if (iy2 <  ny) addValidPosition(TilePosition(line.pos, iy2));
-    }
-  }
-
-  //---
-
-  if (! details_.partial) {
-    //assert((details_.score % 5) == 0);
-  }
-}
-
-void
-Board::
-getBoardLines(BoardLines &boardLines) const
-{
-#ifdef USE_HR_TIMER
-  //auto *timer = CIncrementalTimerMgrInst->get("Board::getBoardLines");
-  //CIncrementalTimerScope stimer(timer);
-#endif
-
-  //---
-
-  TileLine shline, svline;
-
-  auto turnInd = quinto_->turn()->ind();
-
-  const int nx = quinto_->nx();
-  const int ny = quinto_->ny();
-
-  // get horizontal sequence
-  for (const auto &iy : boardLines.yinds) {
-    auto ix = 0;
-
-    while (ix < nx) {
-      // find first tile
-      while (ix < nx && ! cellTile(TilePosition(ix, iy)))
-        ++ix;
-
-      if (ix >= nx)
-        break;
-
-      auto ixs = ix;
-
-      // find last tile
-      while (ix < nx && cellTile(TilePosition(ix, iy)))
-        ++ix;
-
-      auto ixe = ix - 1;
-
-      TileLine line(Direction::HORIZONTAL, ixs, ixe, iy);
-
-      //---
-
-      // ignore unit line
-      if (line.len() == 1) {
-        shline = line;
-        continue;
-      }
-
-      //---
-
-      // line must have current tile in it
-      line.sum = 0;
-
-      auto current = 0;
-
-      for (int ix = line.start; ix <= line.end; ++ix) {
-        auto tile = cellTile(TilePosition(ix, iy));
-
-        if (tile->turn() == turnInd)
-          ++current;
-
-        line.sum += tile->value();
-      }
-
-      if (! current)
-        continue;
-
-      line.current = current;
-
-      //---
-
-      boardLines.hlines.push_back(line);
-    }
-  }
-
-  // get vertical sequences
-  for (const auto &ix : boardLines.xinds) {
-    auto iy = 0;
-
-    while (iy < ny) {
-      // find first tile
-      while (iy < ny && ! cellTile(TilePosition(ix, iy)))
-        ++iy;
-
-      if (iy >= ny)
-        break;
-
-      auto iys = iy;
-
-      // find last tile
-      while (iy < ny && cellTile(TilePosition(ix, iy)))
-        ++iy;
-
-      auto iye = iy - 1;
-
-      TileLine line(Direction::VERTICAL, iys, iye, ix);
-
-      //---
-
-      // ignore unit line
-      if (line.len() == 1) {
-        svline = line;
-        continue;
-      }
-
-      //---
-
-      // line must have current tile in it
-      line.sum = 0;
-
-      auto current = 0;
-
-      for (int iy = line.start; iy <= line.end; ++iy) {
-        auto tile = cellTile(TilePosition(ix, iy));
-
-        if (tile->turn() == turnInd)
-          ++current;
-
-        line.sum += tile->value();
-      }
-
-      if (! current)
-        continue;
-
-      line.current = current;
-
-      //---
-
-      //assert(boardLines.xinds.find(ix) != boardLines.xinds.end());
-
-      boardLines.vlines.push_back(line);
-    }
-  }
-
-  if (boardLines.hlines.empty() && boardLines.vlines.empty()) {
-    auto tile = cellTile(TilePosition(shline.start, shline.pos));
-
-    shline.sum = tile->value();
-    svline.sum = tile->value();
-
-    boardLines.hlines.push_back(shline);
-    boardLines.vlines.push_back(svline);
-  }
-}
-
-int
-Board::
-countTiles(const TilePosition &pos, Side side) const
-{
-  //assert(cellTile(pos));
-
-  const int nx = quinto_->nx();
-  const int ny = quinto_->ny();
-
-  // count run to left, right, top or bottom
-  auto count = 1;
-
-  auto ix = pos.ix;
-  auto iy = pos.iy;
-
-  if      (side == Side::LEFT) {
-    --ix; while (ix >=      0 && cellTile(TilePosition(ix, iy))) { ++count; --ix; }
-  }
-  else if (side == Side::RIGHT) {
-    ++ix; while (ix <= nx - 1 && cellTile(TilePosition(ix, iy))) { ++count; ++ix; }
-  }
-  else if (side == Side::TOP) {
-    --iy; while (iy >=      0 && cellTile(TilePosition(ix, iy))) { ++count; --iy; }
-  }
-  else if (side == Side::BOTTOM) {
-    ++iy; while (iy <= ny - 1 && cellTile(TilePosition(ix, iy))) { ++count; ++iy; }
-  }
-
-  return count;
-}
-
-void
-Board::
-mousePressEvent(QMouseEvent *e)
-{
-  dragPos_  = e->globalPos();
-  dragTile_ = nullptr;
-
-  pressData_ = posToTileData(e->pos());
-
-  const PlayerP &currentPlayer = quinto_->currentPlayer();
-
-  auto turnInd = quinto_->turn()->ind();
-
-  if     (pressData_.owner == TileOwner::PLAYER1 ||
-          pressData_.owner == TileOwner::PLAYER2) {
-    const PlayerP &pressPlayer = quinto_->ownerPlayer(pressData_.owner);
-
-    if (pressPlayer == currentPlayer) {
-      dragTile_ = currentPlayer->tile(pressData_.pos.ix);
-
-      if (dragTile_) {
-        QRect rect(dragPos_, QSize(playerTileSize(), playerTileSize()));
-
-        dragTile_->show(rect);
-      }
-    }
-  }
-  else if (pressData_.owner == TileOwner::BOARD) {
-    TilePosition pressPos = pressData_.pos;
-
-    auto tile = cellTile(pressPos);
-
-    if (tile && tile->turn() == turnInd) {
-      dragTile_ = tile;
-
-      double ts = boardTileSize();
-
-      QRect rect(dragPos_, QSize(ts, ts));
-
-      dragTile_->show(rect);
-    }
-  }
-}
-
-void
-Board::
-mouseMoveEvent(QMouseEvent *e)
-{
-  if (! dragTile_)
-    return;
-
-  auto dragPos = e->globalPos();
-
-  dragTile_->move(dragPos);
-
-  dragPos_ = dragPos;
-}
-
-void
-Board::
-mouseReleaseEvent(QMouseEvent *e)
-{
-  if (! dragTile_)
-    return;
-
-  auto dragTile = dragTile_;
-
-  dragTile_ = nullptr;
-
-  dragTile->hide();
-
-  releaseData_ = posToTileData(e->pos());
-
-  // player -> board
-  if      (pressData_.owner == TileOwner::PLAYER1 ||
-           pressData_.owner == TileOwner::PLAYER2) {
-    if (releaseData_.owner != TileOwner::BOARD)
-      return;
-
-    // ensure destination is empty (TODO: only to valid square)
-    auto tile = this->cellTile(releaseData_.pos);
-
-    if (tile)
-      return;
-  }
-  // board -> player or board
-  else if (pressData_.owner == TileOwner::BOARD) {
-    // board -> player
-    if      (releaseData_.owner == TileOwner::PLAYER1 ||
-             releaseData_.owner == TileOwner::PLAYER2) {
-      const PlayerP &releasePlayer = quinto_->ownerPlayer(releaseData_.owner);
-
-      const PlayerP &currentPlayer = quinto_->currentPlayer();
-
-      if (releasePlayer != currentPlayer)
-        return;
-    }
-    else if (releaseData_.owner == TileOwner::BOARD) {
-      auto pressTile = this->cellTile(pressData_.pos);
-      assert(pressTile == dragTile);
-
-      auto releaseTile = this->cellTile(releaseData_.pos);
-
-      if (releaseTile)
-        return;
-    }
-    else
-      return;
-  }
-  else {
-    return;
-  }
-
-  //---
-
-  Move move(pressData_, releaseData_);
-
-  quinto_->addMove(move);
-
-  quinto_->doMove(move);
-
-  quinto_->updateState();
-}
-
-void
-Board::
-keyPressEvent(QKeyEvent *ke)
-{
-  if      (ke->key() == Qt::Key_B)
-    showBestMove();
-  else if (ke->key() == Qt::Key_P)
-    playBestMove();
-}
-
-TileData
-Board::
-posToTileData(const QPoint &pos) const
-{
-  TileData tileData;
-
-  const int nx = quinto_->nx();
-  const int ny = quinto_->ny();
-
-  auto x = pos.x();
-  auto y = pos.y();
-
-  double ts = boardTileSize();
+  double ts = boardTileSize();
 
   auto ix = int((x - pos_.x())/ts);
   auto iy = int((y - pos_.y())/ts);
@@ -2394,17 +1669,14 @@ posToTileData(const QPoint &pos) const
 
   //---
 
-  const PlayerP &player1 = quinto_->player1();
-  const PlayerP &player2 = quinto_->player2();
-
   const int handSize = quinto_->handSize();
 
-  iy = int((y - player1->tileY())/playerTileSize());
+  iy = int((y - player1TilePos_.y())/playerTileSize());
 
   if (iy == 0) {
     if (quinto_->playMode() == PlayMode::HUMAN_COMPUTER ||
         quinto_->playMode() == PlayMode::HUMAN_HUMAN) {
-      ix = int((x - player1->tileX())/playerTileSize());
+      ix = int((x - player1TilePos_.x())/playerTileSize());
 
       if (ix >= 0 && ix < handSize) {
         tileData.owner = TileOwner::PLAYER1;
@@ -2416,7 +1688,7 @@ posToTileData(const QPoint &pos) const
 
     if (quinto_->playMode() == PlayMode::COMPUTER_HUMAN ||
         quinto_->playMode() == PlayMode::HUMAN_HUMAN) {
-      ix = int((x - player2->tileX())/playerTileSize());
+      ix = int((x - player2TilePos_.x())/playerTileSize());
 
       if (ix >= 0 && ix < handSize) {
         tileData.owner = TileOwner::PLAYER2;
@@ -2432,329 +1704,4 @@ posToTileData(const QPoint &pos) const
 
 //------
 
-int
-BoardLines::
-score() const
-{
-  // score all lines
-  int score = 0;
-
-  for (const auto &line : hlines)
-    score += line.sum;
-
-  for (const auto &line : vlines)
-    score += line.sum;
-
-  return score;
-}
-
-//------
-
-TileLine::
-TileLine(Direction direction, int start, int end, int pos) :
- direction(direction), start(start), end(end), pos(pos)
-{
-}
-
-int
-TileLine::
-len() const
-{
-  //assert(start >= 0 && end >= start);
-
-  return end - start + 1;
-}
-
-bool
-TileLine::
-hasPosition(const TilePosition &p) const
-{
-  if (direction == Direction::HORIZONTAL)
-    return (p.iy == pos && p.ix >= start && p.ix <= end);
-  else
-    return (p.ix == pos && p.iy >= start && p.iy <= end);
-}
-
-TilePosition
-TileLine::
-startPos() const
-{
-  if (direction == Direction::HORIZONTAL)
-    return TilePosition(start, pos);
-  else
-    return TilePosition(pos, start);
-}
-
-bool
-TileLine::
-isValid(LineValid &lineValid) const
-{
-  lineValid.partial = false;
-  lineValid.errMsg  = "";
-
-  if (len() > 5) {
-    lineValid.errMsg = "Line too long";
-    return false;
-  }
-
-  //---
-
-  if ((sum % 5) != 0) {
-    if (len() == 5) {
-      lineValid.errMsg = "Not a multiple of 5";
-      return false;
-    }
-
-    lineValid.partial = true;
-    lineValid.errMsg  = "Not a multiple of 5 (yet)";
-  }
-
-  return true;
-}
-
-void
-TileLine::
-print(std::ostream &os) const
-{
-  if (direction == Direction::HORIZONTAL)
-    os << "H: (" << start << "," << pos << ") (" << end << ") = " << sum;
-  else
-    os << "V: (" << pos << "," << start << ") (" << end << ") = " << sum;
-}
-
-void
-TileLine::
-print(std::ostream &os, const QString &errMsg) const
-{
-  print(os);
-
-  if (errMsg != "")
-    os << " (" << errMsg.toStdString() << ")";
-}
-
-//------
-
-void
-BoardDetails::
-reset()
-{
-  valid = false;
-  score = 0;
-
-  validPositions.clear();
-}
-
-void
-BoardDetails::
-addValidPosition(const TilePosition &pos)
-{
-  validPositions.insert(pos);
-}
-
-//------
-
-MoveTree::
-MoveTree()
-{
-}
-
-MoveTree::
-~MoveTree()
-{
-  for (auto &child : children)
-    delete child;
-}
-
-const MoveTree *
-MoveTree::
-maxLeaf() const
-{
-  ScoreTree scoreTree;
-
-  updateScoreTree(scoreTree);
-
-  if (scoreTree.empty())
-    return nullptr;
-
-  //---
-
-#if 0
-  for (const auto &st : scoreTree) {
-    std::cerr << "Score=" << -st.first << "\n";
-
-    for (const auto &t : st.second) {
-      Moves moves;
-
-      t->hierMoves(moves);
-
-      std::cerr << " ";
-
-      for (const auto &move : moves) {
-        std::cerr << " ";
-
-        move.print(std::cerr);
-      }
-
-      std::cerr << "\n";
-    }
-  }
-#endif
-
-  //---
-
-  const MoveTrees &moveTrees = scoreTree.begin()->second;
-
-  int nt = moveTrees.size();
-  //assert(nt > 0);
-
-  auto minTree = moveTrees[0];
-
-  if (nt == 1)
-    return minTree;
-
-  // best is min or max depth ?
-  auto minDepth = minTree->depth();
-
-  for (int i = 1; i < nt; ++i) {
-    auto tree = moveTrees[i];
-
-    auto depth = tree->depth();
-
-    if (depth < minDepth) {
-      minDepth = depth;
-      minTree  = tree;
-    }
-  }
-
-  return minTree;
-}
-
-void
-MoveTree::
-updateScoreTree(ScoreTree &scoreTree) const
-{
-  // add tree if valid and not partial (non multiple of 5)
-  if (! partial) {
-    //assert((score % 5) == 0);
-
-    scoreTree[-score].push_back(this);
-  }
-
-  if (! children.empty()) {
-    for (const auto &child : children)
-      child->updateScoreTree(scoreTree);
-  }
-}
-
-int
-MoveTree::
-depth() const
-{
-  if (! parent)
-    return 1;
-
-  return parent->depth() + 1;
-}
-
-int
-MoveTree::
-size() const
-{
-  int s = 1;
-
-  for (const auto &child : children)
-    s += child->size();
-
-  return s;
-}
-
-void
-MoveTree::
-hierMoves(Moves &moves) const
-{
-  // get move parent stack
-  moves.push_back(move);
-
-  auto parent = this->parent;
-
-  while (parent) {
-    if (parent->move.isValid())
-      moves.push_back(parent->move);
-
-    parent = parent->parent;
-  }
-
-  // reverse as in wrong order
-  int nm = moves.size();
-
-  for (int i = 0; i < nm/2; ++i)
-    std::swap(moves[i], moves[nm - i - 1]);
-}
-
-void
-MoveTree::
-printDepth(std::ostream &os, int depth) const
-{
-  if (move.isValid()) {
-    os << "{";
-
-    move.print(os);
-
-    os << "}";
-  }
-
-  if (! children.empty()) {
-    os << "\n";
-
-    for (int i = 0; i < depth; ++i)
-      os << " ";
-
-    bool first = true;
-
-    os << "[";
-
-    for (const auto &child : children) {
-      if (! first)
-        os << " ";
-
-      child->printDepth(os, depth + 1);
-
-      first = false;
-    }
-
-    os << "]";
-  }
-
-  os << "@" << score;
-}
-
-void
-MoveTree::
-print(std::ostream &os) const
-{
-  printDepth(os, 0);
-}
-
-//------
-
-Turn::
-Turn(App *quinto, int ind) :
- quinto_(quinto), ind_(ind)
-{
-}
-
-int
-Turn::
-score() const
-{
-  auto score = 0;
-
-  for (const auto &move : moves())
-    score += quinto_->moveScore(move);
-
-  return score;
-}
-
-//------
-
 }
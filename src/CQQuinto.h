@@ -1,9 +1,13 @@
 #ifndef CQQuinto_H
 #define CQQuinto_H
 
+#include <CQuintoEngine.h>
+
 #include <QFrame>
+#include <QThread>
 #include <set>
 #include <memory>
+#include <atomic>
 #include <cassert>
 #include <iostream>
 
@@ -14,42 +18,28 @@ class QComboBox;
 namespace CQQuinto {
 
 class App;
-class TileSet;
-class Player;
-class Turn;
 class Board;
 class Tile;
-class Move;
+class ComputerSearch;
 
 //------
 
-enum class Direction {
-  NONE,
-  HORIZONTAL,
-  VERTICAL
-};
-
-enum class Side {
-  NONE,
-  LEFT,
-  RIGHT,
-  TOP,
-  BOTTOM
-};
-
-enum class TileOwner {
-  NONE,
-  PLAYER1,
-  PLAYER2,
-  BOARD,
-  TILE_SET
-};
+using CQuinto::Direction;
+using CQuinto::Side;
+using CQuinto::TileOwner;
+using CQuinto::PlayerType;
+using CQuinto::PlayerP;
+using CQuinto::TilePosition;
+using CQuinto::TileData;
+using CQuinto::ValidScore;
+using CQuinto::Move;
+using CQuinto::BoardDetails;
+using CQuinto::BestMove;
+using CQuinto::Turn;
+using CQuinto::GameP;
+using CQuinto::Seed;
 
-enum class PlayerType {
-  NONE,
-  HUMAN,
-  COMPUTER
-};
+//------
 
 enum class PlayMode {
   HUMAN_HUMAN,
@@ -58,132 +48,6 @@ enum class PlayMode {
   COMPUTER_COMPUTER
 };
 
-//----
-
-class Player {
- public:
-  using Tiles = std::vector<Tile *>;
-
- public:
-  Player(App *quinto, TileOwner owner, const QString &name, PlayerType type);
-
-  TileOwner owner() const { return owner_; }
-
-  PlayerType type() const { return type_; }
-  void setType(PlayerType type) { type_ = type; }
-
-  const QString &name() const { return name_; }
-  void setName(const QString &s) { name_ = s; }
-
-  const Tiles &tiles() const { return tiles_; }
-
-  int numTiles() const;
-
-  Tile *tile(int i) const;
-
-  Tile *takeTile(int i, bool nocheck=false);
-
-  void addTile(Tile *tile, int i);
-
-  int score() const { return score_; }
-  void setScore(int i) { score_ = i; }
-
-  bool canMove() const { return canMove_; }
-  void setCanMove(bool b) { canMove_ = b; }
-
-  int tileX() const { return tileX_; }
-  void setTileX(int i) { tileX_ = i; }
-
-  int tileY() const { return tileY_; }
-  void setTileY(int i) { tileY_ = i; }
-
-  void addScore(int i) { score_ += i; }
-
-  void drawTiles();
-
- private:
-  App*       quinto_  { nullptr };
-  TileOwner  owner_   { TileOwner::NONE };
-  QString    name_;
-  PlayerType type_    { PlayerType::NONE };
-  Tiles      tiles_;
-  int        score_   { 0 };
-  bool       canMove_ { true };
-  int        tileX_   { 0 };
-  int        tileY_   { 0 };
-};
-
-using PlayerP = std::unique_ptr<Player>;
-
-//------
-
-class TileSet {
- public:
-  TileSet(App *quinto);
- ~TileSet();
-
-  void shuffle();
-
-  Tile *getTile();
-
-  void ungetTile(Tile *tile);
-
- private:
-  using Tiles = std::vector<Tile *>;
-
-  App*  quinto_ { nullptr };
-  Tiles tiles_;
-  Tiles itiles_;
-};
-
-using TileSetP = std::unique_ptr<TileSet>;
-
-//------
-
-struct TilePosition {
-  int ix { -1 };
-  int iy { -1 };
-
-  TilePosition() = default;
-
-  TilePosition(int ix, int iy) :
-   ix(ix), iy(iy) {
-  }
-
-  bool isValid() const { return (ix >= 0 && iy >= 0); }
-
-  TilePosition left  () const { return TilePosition(ix - 1, iy    ); }
-  TilePosition right () const { return TilePosition(ix + 1, iy    ); }
-  TilePosition top   () const { return TilePosition(ix    , iy - 1); }
-  TilePosition bottom() const { return TilePosition(ix    , iy + 1); }
-
-  bool operator==(const TilePosition &rhs) const {
-    return (ix == rhs.ix && iy == rhs.iy);
-  }
-
-  bool operator<(const TilePosition &rhs) const {
-    return (ix < rhs.ix || (ix == rhs.ix && iy < rhs.iy));
-  }
-};
-
-using TilePositions = std::set<TilePosition>;
-
-struct TileData {
-  TileOwner    owner { TileOwner::NONE };
-  TilePosition pos;
-
-  TileData() = default;
-
-  TileData(TileOwner owner, const TilePosition &pos);
-
-  void print(std::ostream &os) const;
-};
-
-struct ValidScore {
-  bool valid { false };
-  int  score { 0 };
-};
-
 //------
 
 class App : public QFrame {
@@ -205,29 +69,30 @@ class App : public QFrame {
   App(QWidget *parent = nullptr);
  ~App();
 
-  int nx() const { return 18; }
-  int ny() const { return 12; }
+  const GameP &game() const { return game_; }
 
-  int handSize() const { return 5; }
+  int nx() const { return game_->nx(); }
+  int ny() const { return game_->ny(); }
 
-  const TileSetP &tileSet() const { return tileSet_; }
+  int handSize() const { return game_->handSize(); }
 
-  const PlayerP &player1() const { return player1_; }
-  const PlayerP &player2() const { return player2_; }
+  const PlayerP &player1() const { return game_->player1(); }
+  const PlayerP &player2() const { return game_->player2(); }
 
-  TileOwner currentPlayerOwner() const { return currentPlayerOwner_; };
+  TileOwner currentPlayerOwner() const { return game_->currentPlayerOwner(); };
 
-  const PlayerP &currentPlayer() const { return ownerPlayer(currentPlayerOwner()); }
+  const PlayerP &currentPlayer() const { return game_->currentPlayer(); }
 
-  const PlayerP &ownerPlayer(TileOwner owner) const {
-    return (owner == TileOwner::PLAYER1 ? player1() : player2());
-  }
+  const PlayerP &ownerPlayer(TileOwner owner) const { return game_->ownerPlayer(owner); }
 
-  Turn *turn() const { return turn_; }
+  Turn *turn() const { return game_->turn(); }
 
   //---
 
-  void init();
+  void init(Seed seed);
+
+  // tile set seed of current game
+  Seed seed() const;
 
   void createWidgets();
 
@@ -268,22 +133,27 @@ class App : public QFrame {
 
   void addMove(const Move &move);
 
-  void undoMove(const Move &move);
-
   void doMove(const Move &move);
 
-  void doMoveParts(const TileData &from, const TileData &to);
-
+  // start background search for computer player best move (played when
+  // search completes)
   void computerMove();
 
   void playComputerMove();
 
-  void nextTurn();
+  // is computer best move search running
+  bool isComputerSearching() const { return computerSearch_ != nullptr; }
 
-  bool isGameOver() const { return gameOver_; }
-  void setGameOver(bool b);
+  // cancel running computer best move and ponder search (result is ignored)
+  void cancelComputerMove();
 
-  bool canMove() const;
+  // search computer reply to human best move while human is on turn (used
+  // when computer turn board matches)
+  bool isPonder() const { return ponder_; }
+  void setPonder(bool b);
+
+  bool isGameOver() const { return game_->isGameOver(); }
+  void setGameOver(bool b);
 
   ValidScore isTurnValid() const;
 
@@ -293,12 +163,19 @@ class App : public QFrame {
 
   void back();
 
-  void newGame();
+  // new game with tile order from seed
+  void newGame(Seed seed);
+
+  // position notation (see CQuinto::Position) at start of current turn
+  QString position() const;
 
-  int moveScore(const Move &move) const;
+  // replace game with position notation, returns false if invalid
+  bool setPosition(const QString &str);
 
   void resizeEvent(QResizeEvent *) override;
 
+  void closeEvent(QCloseEvent *) override;
+
   double calcFontScale(double s) const;
 
   QSize sizeHint() const override;
@@ -309,21 +186,24 @@ class App : public QFrame {
   void applySlot();
   void newGameSlot();
   void modeSlot(int);
+  void computerSearchSlot();
 
  private:
-  void updateWidgets();
+  void startPonder();
+  void cancelPonder();
+
+  void playComputerSearch();
+
+  void releaseSearch(ComputerSearch *search);
 
  private:
-  using Turns = std::vector<Turn *>;
+  void updateWidgets();
 
-  TileSetP  tileSet_;
-  PlayerP   player1_;
-  PlayerP   player2_;
-  Board*    board_    { nullptr };
-  Turn*     turn_     { nullptr };
-  Turns     turns_;
+  void updateTitle();
 
-  TileOwner currentPlayerOwner_ { TileOwner::PLAYER1 };
+ private:
+  GameP  game_;
+  Board* board_ { nullptr };
 
   QColor invalidTileColor_   { "#aa4444" };
   QColor currentTileColor_   { "#7459aa" };
@@ -342,161 +222,74 @@ class App : public QFrame {
 
   double lastFs_ { 1 };
 
-  bool gameOver_ { false };
-
   PlayMode playMode_ { PlayMode::HUMAN_COMPUTER };
-};
 
-//---
-
-class Move {
- public:
-  Move() = default;
-
-  Move(const TileData &from, const TileData &to) :
-   from_(from), to_(to) {
-  }
-
-  const TileData &from() const { return from_; }
-  const TileData &to  () const { return to_  ; }
-
-  bool isValid() const {
-    return (from_.owner != TileOwner::NONE && to_.owner != TileOwner::NONE);
-  }
-
-  void print(std::ostream &os) const {
-    os << "From: "; from_.print(os); os << " To: "; to_.print(os);
-  }
-
- private:
-  TileData from_;
-  TileData to_;
-};
-
-//---
-
-struct LineValid {
-  bool    partial { false };
-  QString errMsg;
-};
-
-//---
-
-struct TileLine {
-  Direction direction { Direction::NONE };
-  int       start     { -1 };
-  int       end       { -1 };
-  int       pos       { -1 };
-  int       sum       { 0 };
-  int       current   { 0 };
-
-  TileLine() = default;
-
-  TileLine(Direction direction, int start, int end, int pos);
-
-  int len() const;
-
-  bool hasPosition(const TilePosition &p) const;
-
-  TilePosition startPos() const;
-
-  bool isValid(LineValid &lineValid) const;
-
-  void print(std::ostream &os) const;
-
-  void print(std::ostream &os, const QString &errMsg) const;
-};
-
-//---
-
-struct BoardDetails {
-  bool          valid   { false };
-  bool          partial { false };
-  int           score   { 0 };
-  int           nt      { 0 };
-  int           npt     { 0 };
-  TilePositions validPositions;
-  QString       errMsg;
-
-  void reset();
-
-  void addValidPosition(const TilePosition &pos);
-};
-
-struct BoardMoves {
-  using Moves = std::vector<Move>;
-
-  int   depth   { 0 };
-  Moves moves;
-  int   score   { 0 };
-  bool  partial { false };
-};
-
-struct BestMove {
-  using Moves = std::vector<Move>;
-
-  Moves moves;
-  int   score { 0 };
-
-  bool isValid() const { return ! moves.empty(); }
-
-  void reset() { moves.clear(); score = 0; }
+  ComputerSearch* computerSearch_ { nullptr }; // running computer move search
+  ComputerSearch* ponderSearch_   { nullptr }; // ponder search
+  bool            ponder_         { true };    // ponder on human turn
 };
 
 //---
 
-struct MoveTree {
-  using Children  = std::vector<MoveTree *>;
-  using MoveTrees = std::vector<const MoveTree *>;
-  using ScoreTree = std::map<int,MoveTrees>;
-  using Moves     = std::vector<Move>;
-
-  MoveTree*         parent  { nullptr };
-  Move              move;
-  Children          children;
-  bool              partial { false };
-  int               score   { 0 };
-  mutable ScoreTree scoreTree;
-
-  MoveTree();
-
- ~MoveTree();
-
-  void addChild(MoveTree *child) {
-    child->parent = this;
+// computer best move search on copy of board and player hand run in
+// background thread (result published by queued searchDone signal).
+//
+// A ponder search is started on the human's turn : it searches the human's
+// best move then the computer's reply to the board after that move
+// (predicted board for next computer turn).
+class ComputerSearch : public QThread {
+  Q_OBJECT
 
-    children.push_back(child);
-  }
+ public:
+  enum class Mode {
+    MOVE,
+    PONDER
+  };
 
-  MoveTree *root() { if (! parent) return this; return parent->root(); }
+ public:
+  ComputerSearch(App *quinto, Mode mode=Mode::MOVE);
+ ~ComputerSearch();
 
-  const MoveTree *maxLeaf() const;
+  Mode mode() const { return mode_; }
 
-  void updateScoreTree(ScoreTree &scoreTree) const;
+  const BestMove &bestMove() const { return bestMove_; }
 
-  int depth() const;
+  const CQuinto::SearchStats &stats() const;
 
-  int size() const;
+  // stop search (stops within a search node)
+  void cancel() { cancel_ = true; }
 
-  void hierMoves(Moves &move) const;
+  bool isCancelled() const { return cancel_; }
 
-  void printDepth(std::ostream &os, int depth) const;
+  // has search completed (best move set)
+  bool isDone() const { return done_; }
 
-  void print(std::ostream &os) const;
-};
+  // is ponder search for board, player (hand) and turn
+  bool isPonderMatch(const CQuinto::Board &board, const CQuinto::Player &player,
+                     int turn) const;
 
-//---
+ signals:
+  void searchDone();
 
-struct BoardLines {
-  using TileLines = std::vector<TileLine>;
-  using Inds      = std::set<int>;
-
-  Inds      xinds;
-  Inds      yinds;
-  TileLines hlines;
-  TileLines vlines;
+ private:
+  void run() override;
 
-  int score() const;
+ private:
+  using SearchP = std::unique_ptr<CQuinto::Search>;
+
+  using Tiles = CQuinto::Player::Tiles;
+
+  Mode              mode_      { Mode::MOVE }; // search mode
+  SearchP           search_;                   // search (copy of board and hand)
+  SearchP           ponderSearch_;             // human best move search (ponder)
+  BestMove          bestMove_;                 // search best move
+  CQuinto::BitBoard ponderBits_;               // predicted board (ponder)
+  TileOwner         owner_     { TileOwner::NONE }; // searching player
+  Tiles             hand_;                     // searching player hand
+  int               turn_      { 0 };          // search turn
+  std::atomic<bool> cancel_    { false };      // cancel search flag
+  std::atomic<bool> predicted_ { false };      // predicted board set (ponder)
+  std::atomic<bool> done_      { false };      // search completed
 };
 
 //---
@@ -504,47 +297,14 @@ struct BoardLines {
 class Board : public QWidget {
   Q_OBJECT
 
- public:
-  using TileLines = std::vector<TileLine>;
-  using Moves     = std::vector<Move>;
-  using MovesList = std::vector<Moves>;
-
  public:
   Board(App *quinto);
 
-  bool validPos(const TilePosition &pos) const {
-    return (pos.ix >= 0 && pos.ix < quinto_->nx() && pos.iy >= 0 && pos.iy < quinto_->ny());
-  }
-
-  Tile *cellTile(const TilePosition &pos) const {
-    return tiles_[pos.iy][pos.ix];
-  }
-
-  Tile *takeCellTile(const TilePosition &pos);
-
-  void setCellTile(const TilePosition &pos, Tile *tile);
-
   //---
 
   void playBestMove(bool next=true);
   void showBestMove() const;
 
-  void invalidateBestMove() { bestMoveValid_ = false; }
-
-  const BestMove &getBestMove() const;
-
-  MoveTree *boardMoveTree() const;
-
-  bool boardMoves(BoardMoves &moves) const;
-
-  //---
-
-  void invalidateDetails() { detailsValid_ = false; }
-
-  const BoardDetails &boardDetails() const;
-
-  void getBoardLines(BoardLines &lines) const;
-
   //---
 
   void drawBoard(QPainter *painter);
@@ -553,13 +313,11 @@ class Board : public QWidget {
   double playerTileSize() const { return ps_; }
 
  private:
-  void calcBestMove();
-
-  void calcBoardDetails();
-
-  bool buildMoveTree(MoveTree *tree, int depth) const;
+  const CQuinto::BoardP &gameBoard() const { return quinto_->game()->board(); }
 
-  int countTiles(const TilePosition &pos, Side side) const;
+  const QPoint &playerTilePos(TileOwner owner) const {
+    return (owner == TileOwner::PLAYER1 ? player1TilePos_ : player2TilePos_);
+  }
 
   TileData posToTileData(const QPoint &pos) const;
 
@@ -571,7 +329,9 @@ class Board : public QWidget {
 
   void drawScores(QPainter *painter);
 
-  void drawTile(QPainter *painter, Tile *tile, const QRectF &rect,
+  void drawStats(QPainter *painter);
+
+  void drawTile(QPainter *painter, int value, const QRectF &rect,
                 double s, const QColor &bgColor, const QColor &fgColor);
 
   void mousePressEvent  (QMouseEvent *) override;
@@ -581,42 +341,32 @@ class Board : public QWidget {
   void keyPressEvent(QKeyEvent *) override;
 
  private:
-  using ColTiles    = std::vector<Tile *>;
-  using RowColTiles = std::vector<ColTiles>;
-
-  App*         quinto_ { nullptr };      // parent app
-  QPointF      pos_    { 0.0, 0.0 };     // draw pos
-  double       bs_     { 1.0 };          // board cell size
-  double       ps_     { 1.0 };          // piece cell size
-  RowColTiles  tiles_;                   // tile grid
-  TileData     pressData_;               // mouse press data
-  TileData     releaseData_;             // mouse release data
-  QPoint       dragPos_;                 // drag position
-  Tile*        dragTile_ { nullptr };    // drag tile
-  BoardDetails details_;                 // board details
-  bool         detailsValid_ { false };  // are board details current
-  BestMove     bestMove_;                // best move
-  bool         bestMoveValid_ { false }; // is best move current
+  App*     quinto_ { nullptr };      // parent app
+  QPointF  pos_    { 0.0, 0.0 };     // draw pos
+  double   bs_     { 1.0 };          // board cell size
+  double   ps_     { 1.0 };          // piece cell size
+  QPoint   player1TilePos_;          // player 1 hand draw pos
+  QPoint   player2TilePos_;          // player 2 hand draw pos
+  TileData pressData_;               // mouse press data
+  TileData releaseData_;             // mouse release data
+  QPoint   dragPos_;                 // drag position
+  Tile*    dragTile_ { nullptr };    // drag tile
+  bool     dragging_ { false };      // is drag tile active
+  bool     showStats_ { false };     // show search stats overlay
+  QString  message_;                 // status message (shown after turn)
 };
 
 //---
 
+// floating tile shown while dragging
 class Tile : public QWidget {
   Q_OBJECT
 
  public:
-  Tile(App *quinto, int ind, int value);
+  Tile(App *quinto);
 
   int value() const { return value_; }
-
-  const TileOwner &owner() const { return owner_; }
-  void setOwner(const TileOwner &o) { owner_ = o; }
-
-  const TileOwner &player() const { return player_; }
-  void setPlayer(const TileOwner &o) { player_ = o; }
-
-  int turn() const { return turn_; }
-  void setTurn(int i) { turn_ = i; }
+  void setValue(int value) { value_ = value; }
 
   void show(const QRect &rect);
   void hide();
@@ -627,50 +377,19 @@ class Tile : public QWidget {
   void setFontScale(double fs) { fs_ = fs; }
 
   void drawTile(QPainter *painter);
-  void drawTile(QPainter *painter, const QRectF &rect);
 
- private:
-  void paintEvent(QPaintEvent *) override;
+  static void drawTile(QPainter *painter, const QRectF &rect, int value,
+                       const QFont &font, const QColor &borderColor);
 
  private:
-  App*      quinto_ { nullptr };
-  int       ind_    { -1 };
-  int       value_  { -1 };
-  TileOwner owner_  { TileOwner::NONE };
-  TileOwner player_ { TileOwner::NONE };
-  int       turn_   { -1 };
-  double    s_      { 1 };
-  double    fs_     { 1 };
-  QFont     font_;
-};
-
-//----
-
-class Turn {
- public:
-  using Moves = std::vector<Move>;
-
- public:
-  Turn(App *quinto, int ind);
-
-  int ind() const { return ind_; }
-
-  const Moves &moves() const { return moves_; }
-
-  const Move &move(int i) { return moves_[i]; }
-
-  void addMove(const Move &move) { moves_.push_back(move); }
-
-  void popMove() { moves_.pop_back(); }
-
-  void clear() { moves_.clear(); }
-
-  int score() const;
+  void paintEvent(QPaintEvent *) override;
 
  private:
-  App*  quinto_ { nullptr };
-  int   ind_    { -1 };
-  Moves moves_;
+  App*   quinto_ { nullptr };
+  int    value_  { -1 };
+  double s_      { 1 };
+  double fs_     { 1 };
+  QFont  font_;
 };
 
 }
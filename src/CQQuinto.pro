@@ -2,6 +2,8 @@ TEMPLATE = app
 
 QT += widgets
 
+CONFIG += thread
+
 TARGET = CQQuinto
 
 DEPENDPATH += .
@@ -27,5 +29,9 @@ INCLUDEPATH += \
 ../include \
 .
 
+PRE_TARGETDEPS = \
+$$LIB_DIR/libCQuintoEngine.a \
+
 unix:LIBS += \
 -L$$LIB_DIR \
+-lCQuintoEngine \